@@ -0,0 +1,135 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#include "cltok.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 부호 없는 정수를 LEB128 varint로 기록한다 */
+static void put_varint(outbuf_t *out, size_t v)
+{
+    unsigned char b[10];
+    size_t n = 0;
+
+    while (v >= 0x80) {
+        b[n++] = (unsigned char)(v | 0x80);
+        v >>= 7;
+    }
+    b[n++] = (unsigned char)v;
+    outbuf_write(out, (const char *)b, n);
+}
+
+/* varint 하나를 읽는다. 입력이 잘렸거나 너무 길면 -1을 돌려준다 */
+static int get_varint(cltok_reader_t *r, size_t *v)
+{
+    size_t x = 0;
+    int shift = 0;
+
+    while (r->p < r->end && shift < 64) {
+        unsigned char b = *r->p++;
+        x |= (size_t)(b & 0x7f) << shift;
+        if (!(b & 0x80)) {
+            *v = x;
+            return 0;
+        }
+        shift += 7;
+    }
+    return -1;
+}
+
+void cltok_write_begin(cltok_writer_t *w, outbuf_t *out)
+{
+    char version = CLTOK_VERSION;
+
+    w->out = out;
+    w->line = 0;
+    w->end = 0;
+    outbuf_write(out, CLTOK_MAGIC, 4);
+    outbuf_write(out, &version, 1);
+}
+
+void cltok_write_token(cltok_writer_t *w, int kind, size_t line, size_t offset, size_t len)
+{
+    put_varint(w->out, (size_t)(kind - CLTOK_KIND_BASE + 1));
+    put_varint(w->out, line - w->line);
+    put_varint(w->out, offset - w->end);
+    put_varint(w->out, len);
+    w->line = line;
+    w->end = offset + len;
+}
+
+void cltok_write_end(cltok_writer_t *w)
+{
+    put_varint(w->out, 0);
+}
+
+/* 헤더를 확인한다. 형식이 맞지 않으면 -1을 돌려준다 */
+int cltok_read_begin(cltok_reader_t *r, const void *data, size_t size)
+{
+    r->p = data;
+    r->end = r->p + size;
+    r->line = 0;
+    r->pos = 0;
+    if (size < 5 || memcmp(r->p, CLTOK_MAGIC, 4) != 0 || r->p[4] != CLTOK_VERSION)
+        return -1;
+    r->p += 5;
+    return 0;
+}
+
+/*
+ * 다음 토큰을 읽어 tok에 채운다.
+ * 토큰의 kind를 돌려주며, 스트림의 끝이면 0을, 형식 오류면 -1을 돌려준다.
+ */
+int cltok_read_token(cltok_reader_t *r, cltok_token_t *tok)
+{
+    size_t kind, dline, gap, len;
+
+    if (get_varint(r, &kind) < 0)
+        return -1;
+    if (kind == 0)
+        return 0;
+    if (get_varint(r, &dline) < 0 || get_varint(r, &gap) < 0 || get_varint(r, &len) < 0)
+        return -1;
+    r->line += dline;
+    tok->kind = (int)kind + CLTOK_KIND_BASE - 1;
+    tok->line = r->line;
+    tok->offset = r->pos + gap;
+    tok->len = len;
+    r->pos = tok->offset + len;
+    return tok->kind;
+}
+
+/*
+ * 파일 전체를 읽어 들인다. 실패하면 NULL을 돌려준다.
+ * 토큰 스트림과 원본 소스를 읽는 도구들(cltok_dump, relex_test)이 함께 쓴다.
+ */
+char *cltok_read_file(const char *path, size_t *size)
+{
+    FILE *fp;
+    char *buf = NULL;
+    size_t cap = 0, len = 0, n;
+
+    if (!(fp = fopen(path, "rb")))
+        return NULL;
+    do {
+        if (len == cap) {
+            char *tmp;
+            cap = cap ? cap * 2 : 65536;
+            if (!(tmp = realloc(buf, cap))) {
+                free(buf);
+                fclose(fp);
+                return NULL;
+            }
+            buf = tmp;
+        }
+        n = fread(buf + len, 1, cap - len, fp);
+        len += n;
+    } while (n > 0);
+    fclose(fp);
+    *size = len;
+    return buf;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 이진 토큰 스트림(.cltok) 형식을 정의한다.
+ *
+ *   헤더   : "CLTK" 4바이트 + 버전 1바이트
+ *   토큰   : kind, 줄번호 증가분, 이전 토큰 끝에서의 오프셋 증가분, 길이를
+ *            차례로 LEB128 varint로 기록한다.
+ *   끝     : kind 자리에 0을 기록한다.
+ *
+ * kind는 cool.tab.h의 토큰 값에서 CLTOK_KIND_BASE를 빼고 1을 더한 값이다.
+ * 렉심은 저장하지 않으므로 원본 소스의 (offset, len)으로 다시 얻는다.
+ */
+#ifndef CLTOK_H
+#define CLTOK_H
+
+#include <stddef.h>
+#include "outbuf.h"
+
+#define CLTOK_MAGIC     "CLTK"
+#define CLTOK_VERSION   1
+#define CLTOK_KIND_BASE 100     /* cool.tab.h의 CLASS */
+
+/* 토큰 하나 */
+typedef struct cltok_token {
+    int kind;
+    size_t line;
+    size_t offset;
+    size_t len;
+} cltok_token_t;
+
+/* 이진 토큰 스트림 기록기 */
+typedef struct cltok_writer {
+    outbuf_t *out;
+    size_t line;
+    size_t end;
+} cltok_writer_t;
+
+/* 이진 토큰 스트림 판독기 */
+typedef struct cltok_reader {
+    const unsigned char *p;
+    const unsigned char *end;
+    size_t line;
+    size_t pos;
+} cltok_reader_t;
+
+/* 함수 프로토타입 선언 */
+void cltok_write_begin(cltok_writer_t *w, outbuf_t *out);
+void cltok_write_token(cltok_writer_t *w, int kind, size_t line, size_t offset, size_t len);
+void cltok_write_end(cltok_writer_t *w);
+
+int cltok_read_begin(cltok_reader_t *r, const void *data, size_t size);
+int cltok_read_token(cltok_reader_t *r, cltok_token_t *tok);
+
+char *cltok_read_file(const char *path, size_t *size);
+
+#endif // CLTOK_H
@@ -0,0 +1,69 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 이진 토큰 스트림(.cltok)과 원본 COOL 파일을 읽어 cool_lexer와 같은
+ * 형식의 토큰 덤프를 출력한다. flex를 다시 돌리지 않고 토큰을 소비하는 예이다.
+ *
+ *   사용법: cltok_dump file.cltok file.cl
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "cool.tab.h"
+#include "cltok.h"
+#include "outbuf.h"
+
+static outbuf_t out;
+
+int main(int argc, char *argv[])
+{
+    char *bin, *src;
+    size_t bin_size, src_size;
+    cltok_reader_t r;
+    cltok_token_t tok;
+    int kind;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s file.cltok file.cl\n", argv[0]);
+        return 1;
+    }
+    if (!(bin = cltok_read_file(argv[1], &bin_size))) {
+        printf("\"%s\"는 잘못된 파일 경로입니다.\n", argv[1]);
+        return 1;
+    }
+    if (!(src = cltok_read_file(argv[2], &src_size))) {
+        printf("\"%s\"는 잘못된 파일 경로입니다.\n", argv[2]);
+        return 1;
+    }
+    if (cltok_read_begin(&r, bin, bin_size) < 0) {
+        fprintf(stderr, "%s: not a token stream\n", argv[1]);
+        return 1;
+    }
+    if (outbuf_init(&out, STDOUT_FILENO) < 0) {
+        perror("cltok_dump");
+        return 1;
+    }
+    while ((kind = cltok_read_token(&r, &tok)) > 0) {
+        if (kind < CLASS || kind > ERROR || tok.offset + tok.len > src_size)
+            break;
+        outbuf_token(&out, tok.line, tokenName[kind-100], strlen(tokenName[kind-100]),
+                     src + tok.offset, tok.len);
+    }
+    if (outbuf_flush(&out) < 0) {
+        perror("cltok_dump");
+        return 1;
+    }
+    if (kind != 0) {
+        fprintf(stderr, "%s: corrupt token stream\n", argv[1]);
+        return 1;
+    }
+    free(bin);
+    free(src);
+    return 0;
+}
@@ -52,6 +52,7 @@
 #define DIV         139
 #define NEG         140
 #define ATSIGN      141
+#define ERROR       142     /* 오류 토큰 모드(--keep-going)에서 잘못된 렉심 */
 
 char *tokenName[] = {
     "CLASS",
@@ -95,5 +96,6 @@ char *tokenName[] = {
     "MUL",
     "DIV",
     "NEG",
-    "ATSIGN"
+    "ATSIGN",
+    "ERROR"
 };
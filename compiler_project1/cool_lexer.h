@@ -0,0 +1,97 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 재진입 가능한 COOL 스캐너의 C 인터페이스.
+ * 줄번호와 주석 깊이 등 스캔 상태는 모두 인스턴스 안에 있으므로
+ * 서로 다른 스레드가 각자의 인스턴스로 동시에 스캔할 수 있다.
+ */
+#ifndef COOL_LEXER_H
+#define COOL_LEXER_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <limits.h>
+#include "outbuf.h"
+#include "lineidx.h"
+#include "lexprof.h"
+
+/* 구간 스캔을 시작할 상태 */
+#define COOL_LEX_INITIAL        0
+#define COOL_LEX_COMMENT        1
+#define COOL_LEX_LINE_COMMENT   2
+
+/*
+ * 스트림 입력을 읽어 들이는 창의 크기와 렉심 하나의 최대 길이(바이트).
+ * 주석과 공백은 flex 버퍼 안에서 건너뛰므로 버퍼는 가장 긴 렉심을 담을 만큼만 자라고,
+ * 그보다 긴 렉심은 오류로 알린다. 따라서 입력 크기와 상관없이 메모리가 일정하다.
+ */
+#define COOL_LEX_WINDOW         (64 * 1024)
+#define COOL_LEX_MAX_TOKEN      (1024 * 1024)
+
+/* 한 flex 버퍼로 스캔할 수 있는 가장 큰 입력. flex는 버퍼 크기를 int로 다룬다 */
+#define COOL_LEX_MAX_RANGE      ((size_t)INT_MAX - 2)
+
+/* 오류 토큰 모드에서 모은 진단이나 deferred에서 미뤄 둔 경고 하나 */
+typedef struct cool_diag {
+    size_t line;
+    size_t offset;
+    char msg[64];
+} cool_diag_t;
+
+/* 토큰 하나. text는 다음 cool_lexer_next() 호출 전까지만 유효하다 */
+typedef struct cool_token {
+    int kind;
+    size_t line;
+    size_t offset;
+    size_t len;
+    const char *text;
+} cool_token_t;
+
+/* 스캐너 인스턴스 */
+typedef struct cool_lexer {
+    void *scanner;          /* flex의 yyscan_t */
+    lineidx_t lines;        /* 줄바꿈 색인. 줄번호는 cool_lexer_line()으로 구한다 */
+    int comment_depth;
+    size_t tokenOffset;     /* 마지막으로 인식한 렉심의 바이트 오프셋 */
+    size_t nextOffset;      /* 다음 렉심이 시작할 바이트 오프셋 */
+    size_t limit;           /* 이 오프셋 이후에서 시작하는 렉심 앞에서 멈춘다 */
+    int speculative;        /* 오류를 만나면 끝내지 않고 failed를 세운 뒤 멈춘다 */
+    int failed;
+    int recover;            /* 오류를 만나면 진단을 모으고 ERROR 토큰을 돌려준 뒤 계속한다 */
+    int deferred;           /* 오류로 끝내지 않고 첫 오류 메시지를 errmsg에 남긴 뒤 멈춘다 */
+    char errmsg[64];        /* deferred일 때 끝냈어야 할 오류의 메시지(줄바꿈 포함) */
+    cool_diag_t *diags;     /* recover일 때 모은 진단과 deferred일 때 미룬 경고. cool_lexer_close()가 해제한다 */
+    size_t ndiags;
+    size_t dcap;
+    char *buf;              /* 스캔 중인 버퍼(mmap 영역 또는 복사본) */
+    size_t buf_off;         /* buf[0]의 입력 안 오프셋(구간 매핑은 start가 든 페이지) */
+    size_t buf_len;
+    int mapped;
+    int borrowed;           /* buf를 호출자가 빌려 준 경우(cool_lexer_open_mem) */
+    FILE *fp;               /* 스트림으로 열었을 때 닫아야 할 파일 */
+#ifdef COOL_LEX_PROFILE
+    lexprof_t prof;         /* 규칙별 프로파일. cool_lexer_close()가 합계에 더한다 */
+#endif
+} cool_lexer_t;
+
+/* 함수 프로토타입 선언 */
+cool_lexer_t *cool_lexer_open_buffer(const char *buf, size_t len);
+cool_lexer_t *cool_lexer_open_file(const char *path);
+cool_lexer_t *cool_lexer_open_stream(FILE *fp);
+cool_lexer_t *cool_lexer_open_range(int fd, size_t start, size_t limit,
+                                    size_t line, int state, int depth);
+cool_lexer_t *cool_lexer_open_mem(char *buf, size_t len, size_t start, size_t line);
+int cool_lexer_state(cool_lexer_t *lx);
+size_t cool_lexer_line(cool_lexer_t *lx, size_t offset);
+int cool_lexer_next(cool_lexer_t *lx, cool_token_t *tok);
+void cool_lexer_close(cool_lexer_t *lx);
+const char *cool_token_name(int kind);
+void cool_lexer_dump(cool_lexer_t *lx, outbuf_t *out);
+void cool_lexer_dump_bin(cool_lexer_t *lx, outbuf_t *out);
+
+#endif // COOL_LEXER_H
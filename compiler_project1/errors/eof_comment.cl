@@ -0,0 +1,6 @@
+class Main {
+  f() : Int { 1 };
+};
+(* an unterminated comment
+  (* nested *)
+  still open
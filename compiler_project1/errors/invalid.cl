@@ -0,0 +1,9 @@
+class Main inherits IO {
+  main() : Object {
+    out_string("a" # "b")
+  };
+  x : Int <- 3 $ 4;
+};
+*) oops
+-- comment with # inside is fine
+class A { y : Int;  };
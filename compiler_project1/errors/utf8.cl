@@ -0,0 +1,5 @@
+class Main inherits IO {
+  -- 한글  ok
+  (* —  x  *)
+  main() : Object { out_string("안녕  ") };
+};
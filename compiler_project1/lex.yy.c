@@ -0,0 +1,2073 @@
+
+#define  YY_INT_ALIGNED short int
+
+/* A lexical scanner generated by flex (flexemu stand-in, 2.6.4 skeleton) */
+
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 6
+#define YY_FLEX_SUBMINOR_VERSION 4
+#if YY_FLEX_SUBMINOR_VERSION > 0
+#define FLEX_BETA
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#ifndef FLEXINT_H
+#define FLEXINT_H
+#include <inttypes.h>
+typedef int8_t flex_int8_t;
+typedef uint8_t flex_uint8_t;
+typedef int16_t flex_int16_t;
+typedef uint16_t flex_uint16_t;
+typedef int32_t flex_int32_t;
+typedef uint32_t flex_uint32_t;
+#endif /* ! FLEXINT_H */
+
+#define yyconst const
+
+#if defined(__GNUC__) && __GNUC__ >= 3
+#define yynoreturn __attribute__((__noreturn__))
+#else
+#define yynoreturn
+#endif
+
+#define YY_NULL 0
+
+#define YY_SC_TO_UI(c) ((YY_CHAR) (c))
+
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+
+#define yyin yyg->yyin_r
+#define yyout yyg->yyout_r
+#define yyextra yyg->yyextra_r
+#define yyleng yyg->yyleng_r
+#define yytext yyg->yytext_r
+#define yylineno (YY_CURRENT_BUFFER_LVALUE->yy_bs_lineno)
+#define yycolumn (YY_CURRENT_BUFFER_LVALUE->yy_bs_column)
+#define yy_flex_debug yyg->yy_flex_debug_r
+
+#define BEGIN yyg->yy_start = 1 + 2 *
+#define YY_START ((yyg->yy_start - 1) / 2)
+#define YYSTATE YY_START
+#define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
+#define YY_NEW_FILE yyrestart( yyin , yyscanner )
+#define YY_END_OF_BUFFER_CHAR 0
+
+#ifndef YY_BUF_SIZE
+#define YY_BUF_SIZE 16384
+#endif
+
+#define YY_STATE_BUF_SIZE   ((YY_BUF_SIZE + 2) * sizeof(yy_state_type))
+
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+
+#ifndef YY_TYPEDEF_YY_SIZE_T
+#define YY_TYPEDEF_YY_SIZE_T
+typedef size_t yy_size_t;
+#endif
+
+#define EOB_ACT_CONTINUE_SCAN 0
+#define EOB_ACT_END_OF_FILE 1
+#define EOB_ACT_LAST_MATCH 2
+
+    #define YY_LESS_LINENO(n)
+    #define YY_LINENO_REWIND_TO(ptr)
+
+#define yyless(n) \
+	do \
+		{ \
+        int yyless_macro_arg = (n); \
+        YY_LESS_LINENO(yyless_macro_arg);\
+		*yy_cp = yyg->yy_hold_char; \
+		YY_RESTORE_YY_MORE_OFFSET \
+		yyg->yy_c_buf_p = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
+		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
+		} \
+	while ( 0 )
+#define unput(c) yyunput( c, yyg->yytext_ptr , yyscanner )
+
+#ifndef YY_STRUCT_YY_BUFFER_STATE
+#define YY_STRUCT_YY_BUFFER_STATE
+struct yy_buffer_state
+	{
+	FILE *yy_input_file;
+	char *yy_ch_buf;		/* input buffer */
+	char *yy_buf_pos;		/* current position in input buffer */
+	int yy_buf_size;
+	int yy_n_chars;
+	int yy_is_our_buffer;
+	int yy_is_interactive;
+	int yy_at_bol;
+    int yy_bs_lineno; /**< The line count. */
+    int yy_bs_column; /**< The column count. */
+	int yy_fill_buffer;
+	int yy_buffer_status;
+#define YY_BUFFER_NEW 0
+#define YY_BUFFER_NORMAL 1
+#define YY_BUFFER_EOF_PENDING 2
+	};
+#endif /* !YY_STRUCT_YY_BUFFER_STATE */
+
+#define YY_CURRENT_BUFFER ( yyg->yy_buffer_stack \
+                          ? yyg->yy_buffer_stack[yyg->yy_buffer_stack_top] \
+                          : NULL)
+#define YY_CURRENT_BUFFER_LVALUE yyg->yy_buffer_stack[yyg->yy_buffer_stack_top]
+
+void yyrestart ( FILE *input_file , yyscan_t yyscanner );
+void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size , yyscan_t yyscanner );
+void yy_delete_buffer ( YY_BUFFER_STATE b , yyscan_t yyscanner );
+void yy_flush_buffer ( YY_BUFFER_STATE b , yyscan_t yyscanner );
+void yypush_buffer_state ( YY_BUFFER_STATE new_buffer , yyscan_t yyscanner );
+void yypop_buffer_state ( yyscan_t yyscanner );
+
+static void yyensure_buffer_stack ( yyscan_t yyscanner );
+static void yy_load_buffer_state ( yyscan_t yyscanner );
+static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file , yyscan_t yyscanner );
+#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER , yyscanner)
+
+YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_scan_string ( const char *yy_str , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, int len , yyscan_t yyscanner );
+
+void *yyalloc ( yy_size_t , yyscan_t yyscanner );
+void *yyrealloc ( void *, yy_size_t , yyscan_t yyscanner );
+void yyfree ( void * , yyscan_t yyscanner );
+
+#define yywrap(yyscanner) (/*CONSTCOND*/1)
+#define YY_SKIP_YYWRAP
+typedef flex_uint8_t YY_CHAR;
+
+typedef int yy_state_type;
+
+#define yytext_ptr yytext_r
+
+static yy_state_type yy_get_previous_state ( yyscan_t yyscanner );
+static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  , yyscan_t yyscanner);
+static int yy_get_next_buffer ( yyscan_t yyscanner );
+static void yynoreturn yy_fatal_error ( const char* msg , yyscan_t yyscanner );
+
+#define YY_DO_BEFORE_ACTION \
+	yyg->yytext_ptr = yy_bp; \
+	yyleng = (int) (yy_cp - yy_bp); \
+	yyg->yy_hold_char = *yy_cp; \
+	*yy_cp = '\0'; \
+	yyg->yy_c_buf_p = yy_cp;
+
+#define YY_NUM_RULES 39
+#define YY_END_OF_BUFFER 40
+#define YY_JAM_STATE 101
+#define YY_NUL_EC 1
+#define YY_NUM_EC 39
+static const flex_int16_t yy_accept[102] =
+    {
+            0,     0,     0,     0,     0,     0,     0,    38,    12,    12,
+           38,    18,    19,    20,    34,    32,    28,    33,    31,    35,
+           16,    30,    29,    25,    27,    37,    14,    15,    21,    22,
+           36,     3,     5,     5,     4,     4,     4,     4,     4,     4,
+            4,     4,     9,    11,    10,    10,    10,    10,    10,    10,
+           10,    10,    13,    18,    17,    18,     1,     7,     8,    16,
+           24,    23,    26,    14,    15,     2,     6,     3,     4,     4,
+            4,     4,     4,     4,     9,    10,    10,    10,    10,    10,
+           10,    18,     3,     3,     3,     4,     4,     4,     9,     9,
+            9,    10,    10,    10,     3,     3,     3,     9,     9,     9,
+           40,     0
+    } ;
+static const YY_CHAR yy_ec[256] =
+    {
+            0,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+            3,     1,     1,     4,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     2,     1,     5,     1,     1,     1,     1,     1,
+            6,     7,     8,     9,    10,    11,    12,    13,    14,    14,
+           14,    14,    14,    14,    14,    14,    14,    14,    15,    16,
+           17,    18,    19,     1,    20,    21,    21,    21,    21,    21,
+           21,    21,    21,    21,    21,    21,    21,    21,    21,    21,
+           21,    21,    21,    21,    21,    21,    21,    21,    21,    21,
+           21,     1,    22,     1,     1,    23,     1,    23,    24,    23,
+           23,    23,    24,    23,    23,    23,    23,    23,    23,    23,
+           24,    23,    23,    23,    23,    23,    24,    23,    23,    23,
+           23,    23,    23,    25,     1,    26,    27,     1,    28,    28,
+           28,    28,    28,    28,    28,    28,    28,    28,    28,    28,
+           28,    28,    28,    28,    29,    29,    29,    29,    29,    29,
+           29,    29,    29,    29,    29,    29,    29,    29,    29,    29,
+           30,    30,    30,    30,    30,    30,    30,    30,    30,    30,
+           30,    30,    30,    30,    30,    30,    30,    30,    30,    30,
+           30,    30,    30,    30,    30,    30,    30,    30,    30,    30,
+           30,    30,    31,    31,    32,    32,    32,    32,    32,    32,
+           32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+           32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+           32,    32,    32,    32,    33,    34,    34,    34,    34,    34,
+           34,    34,    34,    34,    34,    34,    34,    35,    34,    34,
+           36,    37,    37,    37,    38,    31,    31,    31,    31,    31,
+           31,    31,    31,    31,    31,    31
+    } ;
+static const flex_int16_t yy_nxt[102][YY_NUM_EC] =
+    {
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {100,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,7,25,26,7,27,27,28,29,30,7,7,7,7,7,7,7,7,7,7,7},
+    {100,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,7,25,26,7,27,27,28,29,30,7,7,7,7,7,7,7,7,7,7,7},
+    {100,31,31,31,31,31,32,31,33,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,34,34,34,34,35,36,37,38,39,40,41},
+    {100,31,31,31,31,31,32,31,33,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,34,34,34,34,35,36,37,38,39,40,41},
+    {100,42,42,43,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,44,44,44,44,45,46,47,48,49,50,51},
+    {100,42,42,43,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,44,44,44,44,45,46,47,48,49,50,51},
+    {100,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7},
+    {100,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8},
+    {100,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9},
+    {100,-10,-10,52,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10},
+    {100,53,53,-11,53,54,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,55,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53},
+    {100,-12,-12,-12,-12,-12,-12,-12,56,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12},
+    {100,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13},
+    {100,-14,-14,-14,-14,-14,-14,57,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14},
+    {100,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15},
+    {100,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16},
+    {100,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,58,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17},
+    {100,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18},
+    {100,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19},
+    {100,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,59,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20},
+    {100,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21},
+    {100,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22},
+    {100,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,60,-23,-23,-23,-23,-23,-23,61,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23},
+    {100,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,62,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24},
+    {100,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25},
+    {100,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,63,-26,-26,-26,-26,-26,-26,63,-26,63,63,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26},
+    {100,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,64,-27,-27,-27,-27,-27,-27,64,-27,64,64,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27},
+    {100,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28},
+    {100,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29},
+    {100,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30},
+    {100,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31,-31},
+    {100,-32,-32,-32,-32,-32,-32,-32,65,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32},
+    {100,-33,-33,-33,-33,-33,-33,66,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33},
+    {100,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34},
+    {100,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,67,67,67,-35,-35,-35,-35,-35,-35,-35,-35},
+    {100,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,68,-36,-36,-36,-36,-36,-36,-36,-36},
+    {100,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,69,69,69,-37,-37,-37,-37,-37,-37,-37,-37},
+    {100,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,70,70,-38,-38,-38,-38,-38,-38,-38,-38,-38},
+    {100,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,71,71,-39,-39,-39,-39,-39,-39,-39,-39},
+    {100,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,72,72,72,-40,-40,-40,-40,-40,-40,-40,-40},
+    {100,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,73,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41},
+    {100,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42},
+    {100,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43},
+    {100,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44},
+    {100,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,74,74,74,-45,-45,-45,-45,-45,-45,-45,-45},
+    {100,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,75,-46,-46,-46,-46,-46,-46,-46,-46},
+    {100,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,76,76,76,-47,-47,-47,-47,-47,-47,-47,-47},
+    {100,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,77,77,-48,-48,-48,-48,-48,-48,-48,-48,-48},
+    {100,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,78,78,-49,-49,-49,-49,-49,-49,-49,-49},
+    {100,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,79,79,79,-50,-50,-50,-50,-50,-50,-50,-50},
+    {100,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51,80,-51,-51,-51,-51,-51,-51,-51,-51,-51,-51},
+    {100,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52},
+    {100,53,53,-53,53,54,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,55,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53},
+    {100,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54},
+    {100,-55,-55,-55,-55,81,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,81,-55,81,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55},
+    {100,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56},
+    {100,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57,-57},
+    {100,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58},
+    {100,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59},
+    {100,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60,-60},
+    {100,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61,-61},
+    {100,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62,-62},
+    {100,-63,-63,-63,-63,-63,-63,-63,-63,-63,-63,-63,-63,-63,63,-63,-63,-63,-63,-63,-63,63,-63,63,63,-63,-63,-63,-63,-63,-63,-63,-63,-63,-63,-63,-63,-63,-63},
+    {100,-64,-64,-64,-64,-64,-64,-64,-64,-64,-64,-64,-64,-64,64,-64,-64,-64,-64,-64,-64,64,-64,64,64,-64,-64,-64,-64,-64,-64,-64,-64,-64,-64,-64,-64,-64,-64},
+    {100,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65,-65},
+    {100,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66},
+    {100,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67,-67},
+    {100,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,-68,82,82,82,-68,-68,-68,-68,-68,-68,-68,-68},
+    {100,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,-69,83,83,83,-69,-69,-69,-69,-69,-69,-69,-69},
+    {100,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,84,84,84,-70,-70,-70,-70,-70,-70,-70,-70},
+    {100,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,-71,85,85,85,-71,-71,-71,-71,-71,-71,-71,-71},
+    {100,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,86,86,86,-72,-72,-72,-72,-72,-72,-72,-72},
+    {100,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,87,87,87,-73,-73,-73,-73,-73,-73,-73,-73},
+    {100,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74,-74},
+    {100,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,-75,88,88,88,-75,-75,-75,-75,-75,-75,-75,-75},
+    {100,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,89,89,89,-76,-76,-76,-76,-76,-76,-76,-76},
+    {100,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,-77,90,90,90,-77,-77,-77,-77,-77,-77,-77,-77},
+    {100,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,-78,91,91,91,-78,-78,-78,-78,-78,-78,-78,-78},
+    {100,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,-79,92,92,92,-79,-79,-79,-79,-79,-79,-79,-79},
+    {100,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,93,93,93,-80,-80,-80,-80,-80,-80,-80,-80},
+    {100,53,53,-81,53,54,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,55,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53},
+    {100,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82,-82},
+    {100,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83,-83},
+    {100,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84,-84},
+    {100,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,-85,94,94,94,-85,-85,-85,-85,-85,-85,-85,-85},
+    {100,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,-86,95,95,95,-86,-86,-86,-86,-86,-86,-86,-86},
+    {100,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,-87,96,96,96,-87,-87,-87,-87,-87,-87,-87,-87},
+    {100,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88,-88},
+    {100,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89,-89},
+    {100,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90,-90},
+    {100,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,97,97,97,-91,-91,-91,-91,-91,-91,-91,-91},
+    {100,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,-92,98,98,98,-92,-92,-92,-92,-92,-92,-92,-92},
+    {100,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,-93,99,99,99,-93,-93,-93,-93,-93,-93,-93,-93},
+    {100,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94,-94},
+    {100,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95},
+    {100,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96,-96},
+    {100,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97,-97},
+    {100,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98,-98},
+    {100,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99,-99},
+    {-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100},
+    {-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101,-101}
+    } ;
+
+#define REJECT reject_used_but_not_detected
+#define yymore() yymore_used_but_not_detected
+#define YY_MORE_ADJ 0
+#define YY_RESTORE_YY_MORE_OFFSET
+
+#line 1 "cool.l"
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#define YY_NO_INPUT 1
+#define YY_NO_UNPUT 1
+#line 11 "cool.l"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "cool.tab.h"
+#include "cool_lexer.h"
+#include "keyword.h"
+#include "cltok.h"
+#include "skip.h"
+#include "lexprof.h"
+
+/*
+ * 렉심마다 바이트 오프셋을 센다. limit 이후에서 시작하는 렉심을 만나면
+ * 소비하지 않고 되돌려 놓은 채 멈춘다(구간 스캔, cool_lexer_open_range()).
+ * 프로파일 빌드에서는 규칙(yy_act)별로 센다(lexprof.h).
+ */
+#define YY_USER_ACTION { \
+    yyextra->tokenOffset = yyextra->nextOffset; \
+    if (yyextra->tokenOffset >= yyextra->limit) { \
+        yyless(0); \
+        return YY_NULL; \
+    } \
+    LEXPROF_MATCH(&yyextra->prof, yy_act, YY_START, yytext, yyleng); \
+    if (yyleng > COOL_LEX_MAX_TOKEN) { \
+        SPECULATION_FAIL(); \
+        LEX_ERROR("Token too long"); \
+    } \
+    yyextra->nextOffset += yyleng; \
+}
+
+/*
+ * 스트림 입력은 flex가 버퍼를 다시 채우면서 지나간 내용을 버리므로 읽는 즉시 줄바꿈을
+ * 색인한다. 버퍼 입력은 줄번호가 필요할 때 cool_lexer_line()이 색인한다.
+ * 지금 인식 중인 렉심 앞의 줄바꿈은 더 조회하지 않으므로 색인에서 버린다.
+ * buf 앞에는 인식 중인 렉심이 옮겨져 있으므로, 그 길이가 한도를 넘으면 flex가 버퍼를
+ * 더 키우기 전에 오류로 멈춘다. deferred이면 입력 끝을 알리고, 그 렉심의 규칙에서
+ * YY_USER_ACTION이 같은 오류로 멈춘다.
+ */
+#define YY_READ_BUF_SIZE COOL_LEX_WINDOW
+#define YY_INPUT(buf, result, max_size) { \
+    if ((size_t)((buf) - YY_CURRENT_BUFFER_LVALUE->yy_ch_buf) > COOL_LEX_MAX_TOKEN) { \
+        setErrMsg(yyextra, "Token too long"); \
+        if (!yyextra->deferred) \
+            exit(1); \
+        result = 0; \
+    } else { \
+        lineidx_trim(&yyextra->lines, yyextra->nextOffset); \
+        errno = 0; \
+        while ((result = fread(buf, 1, max_size, yyin)) == 0 && ferror(yyin)) { \
+            if (errno != EINTR) \
+                YY_FATAL_ERROR("input in flex scanner failed"); \
+            errno = 0; \
+            clearerr(yyin); \
+        } \
+        if (lineidx_add(&yyextra->lines, buf, result) < 0) \
+            YY_FATAL_ERROR("out of memory in line index"); \
+    } \
+}
+
+/* 추측 스캔 중에는 오류로 끝내지 않고 실패로 표시한 뒤 멈춘다 */
+#define SPECULATION_FAIL() do { \
+    if (yyextra->speculative) { \
+        yyextra->failed = 1; \
+        yyterminate(); \
+    } \
+} while (0)
+
+/*
+ * 더 스캔할 수 없는 오류 msg를 알리고 끝낸다. deferred이면 끝내지 않고 메시지를
+ * errmsg에 남긴 뒤 입력 끝처럼 멈춘다.
+ */
+#define LEX_ERROR(msg) do { \
+    setErrMsg(yyextra, msg); \
+    if (yyextra->deferred) \
+        yyterminate(); \
+    exit(1); \
+} while (0)
+
+/*
+ * 잘못된 문자 yytext[0]을 알린다. 오류 토큰 모드에서는 그 한 바이트를 ERROR 토큰으로
+ * 돌려주고 다음 바이트부터 계속한다.
+ */
+#define INVALID_CHAR() do { \
+    SPECULATION_FAIL(); \
+    if (yyextra->recover) { \
+        add_diag(yyextra, yyextra->tokenOffset, "Invalid character", \
+                 (unsigned char)yytext[0]); \
+        return ERROR; \
+    } \
+    if (yyextra->deferred) { \
+        snprintf(yyextra->errmsg, sizeof(yyextra->errmsg), \
+                 "Invalid character %.1s in line %zu\n", yytext, \
+                 cool_lexer_line(yyextra, yyextra->tokenOffset)); \
+        yyterminate(); \
+    } \
+    fprintf(stderr, "Invalid character %.1s in line %zu\n", yytext, \
+            cool_lexer_line(yyextra, yyextra->tokenOffset)); \
+    exit(1); \
+} while (0)
+
+/*
+ * 렉심 yytext에 있는 잘못된 UTF-8을 알린다. 추측 스캔에서는 경고가 순서대로 출력되도록
+ * 실패로 표시하고 멈춘다.
+ */
+#define BAD_UTF8() do { \
+    SPECULATION_FAIL(); \
+    bad_utf8(yyextra, yyextra->tokenOffset); \
+} while (0)
+
+/*
+ * 주석 본문이나 공백처럼 토큰을 만들지 않는 구간을 flex 버퍼에서 직접 건너뛴다.
+ * yytext를 만들며 '\0'으로 바꿔 둔 바이트를 되돌린 뒤, scan 함수가 찾은 위치까지
+ * 스캔 위치를 옮긴다. 현재 버퍼에 읽혀 있는 범위만 건너뛰므로 버퍼 끝에서는
+ * flex가 평소처럼 다음 입력을 읽는다. 구간 스캔에서는 limit을 넘어 건너뛰지 않으므로
+ * 청크 경계(parlex.h)에서 정확히 멈춘다.
+ */
+#define SKIP_TEXT(scan) do { \
+    char *end_ = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + yyg->yy_n_chars; \
+    char *p_; \
+    if (yyextra->nextOffset >= yyextra->limit) \
+        end_ = yyg->yy_c_buf_p; \
+    else if (yyextra->limit - yyextra->nextOffset < (size_t)(end_ - yyg->yy_c_buf_p)) \
+        end_ = yyg->yy_c_buf_p + (yyextra->limit - yyextra->nextOffset); \
+    *yyg->yy_c_buf_p = yyg->yy_hold_char; \
+    p_ = (char *)scan(yyg->yy_c_buf_p, end_); \
+    yyextra->nextOffset += (size_t)(p_ - yyg->yy_c_buf_p); \
+    LEXPROF_BYTES(&yyextra->prof, yy_act, (size_t)(p_ - yyg->yy_c_buf_p)); \
+    yyg->yy_c_buf_p = p_; \
+    yyg->yy_hold_char = *p_; \
+} while (0)
+
+void setErrMsg(cool_lexer_t *lx, const char* msg) {
+    if (lx->deferred) {
+        if (!lx->errmsg[0])
+            snprintf(lx->errmsg, sizeof(lx->errmsg), "Error: %s at line %zu\n", msg,
+                     cool_lexer_line(lx, lx->nextOffset));
+        return;
+    }
+    fprintf(stderr, "Error: %s at line %zu\n", msg, cool_lexer_line(lx, lx->nextOffset));
+}
+
+/*
+ * 오류 토큰 모드나 deferred에서 offset 위치의 진단을 모은다. 스트림 입력은 지나간 줄바꿈 색인을
+ * 버리므로 줄번호는 이때 구해 둔다. ch가 0 이상이면 문제의 바이트를 문구 뒤에 붙인다.
+ */
+static void add_diag(cool_lexer_t *lx, size_t offset, const char *msg, int ch)
+{
+    cool_diag_t *d;
+
+    if (lx->ndiags == lx->dcap) {
+        size_t cap = lx->dcap ? lx->dcap * 2 : 8;
+        if (!(d = realloc(lx->diags, sizeof(cool_diag_t) * cap))) {
+            perror("cool_lexer");
+            exit(1);
+        }
+        lx->diags = d;
+        lx->dcap = cap;
+    }
+    d = &lx->diags[lx->ndiags++];
+    d->line = cool_lexer_line(lx, offset);
+    d->offset = offset;
+    if (ch < 0)
+        snprintf(d->msg, sizeof(d->msg), "%s", msg);
+    else if (isprint(ch))
+        snprintf(d->msg, sizeof(d->msg), "%s '%c'", msg, ch);
+    else
+        snprintf(d->msg, sizeof(d->msg), "%s '\\x%02x'", msg, ch);
+}
+
+/*
+ * 주석이나 문자열 안의 잘못된 UTF-8을 바이트 오프셋과 함께 알린다. 토큰에는 영향이 없으므로
+ * 스캔을 계속한다. 오류 토큰 모드에서는 진단으로 모은다. deferred이면 작업 스레드에서
+ * 바로 출력하지 않도록 경고를 진단으로 남겨 두고, 호출자가 그 파일의 차례에 출력한다.
+ */
+static void bad_utf8(cool_lexer_t *lx, size_t offset)
+{
+    char msg[64];
+
+    if (lx->recover || lx->deferred) {
+        snprintf(msg, sizeof(msg), "%sInvalid UTF-8 at byte %zu", lx->recover ? "" : "Warning: ",
+                 offset);
+        add_diag(lx, offset, msg, -1);
+    } else
+        fprintf(stderr, "Warning: Invalid UTF-8 at byte %zu in line %zu\n", offset,
+                cool_lexer_line(lx, offset));
+}
+
+/* 문자열 상수 s(길이 len, 오프셋 offset)에서 잘못된 UTF-8을 모두 알린다 */
+static void check_string_utf8(cool_lexer_t *lx, const char *s, size_t len, size_t offset)
+{
+    const char *end = s + len, *p;
+
+    for (p = skip_utf8(s, end); p < end; p = skip_utf8(p + utf8_bad_len(p, end), end))
+        bad_utf8(lx, offset + (size_t)(p - s));
+}
+#line 216 "cool.l"
+    /*
+     * 올바른 UTF-8 다중 바이트 문자 하나와, 그 밖의 0x80 이상인 바이트로 시작하는 가장 긴
+     * 잘못된 조각. BADUTF8은 UTF8의 모든 앞부분을 포함하므로 스캐너가 되돌아가지 않는다.
+     */
+#line 542 "lex.yy.c"
+
+#define INITIAL 0
+#define COMMENT 1
+#define S_LINE_COMMENT 2
+
+#ifndef YY_NO_UNISTD_H
+#include <unistd.h>
+#endif
+
+#define YY_EXTRA_TYPE cool_lexer_t *
+
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+
+/* Holds the entire state of the reentrant scanner. */
+struct yyguts_t
+    {
+    YY_EXTRA_TYPE yyextra_r;
+    FILE *yyin_r, *yyout_r;
+    size_t yy_buffer_stack_top; /**< index of top of stack. */
+    size_t yy_buffer_stack_max; /**< capacity of stack. */
+    YY_BUFFER_STATE * yy_buffer_stack; /**< Stack as an array. */
+    char yy_hold_char;
+    int yy_n_chars;
+    int yyleng_r;
+    char *yy_c_buf_p;
+    int yy_init;
+    int yy_start;
+    int yy_did_buffer_switch_on_eof;
+    int yy_start_stack_ptr;
+    int yy_start_stack_depth;
+    int *yy_start_stack;
+    yy_state_type yy_last_accepting_state;
+    char* yy_last_accepting_cpos;
+    int yylineno_r;
+    int yy_flex_debug_r;
+    char *yytext_r;
+    int yy_more_flag;
+    int yy_more_len;
+    }; /* end struct yyguts_t */
+
+static int yy_init_globals ( yyscan_t yyscanner );
+
+int yylex_init (yyscan_t* scanner);
+int yylex_init_extra ( YY_EXTRA_TYPE user_defined, yyscan_t* scanner);
+int yylex_destroy ( yyscan_t yyscanner );
+int yyget_debug ( yyscan_t yyscanner );
+void yyset_debug ( int debug_flag , yyscan_t yyscanner );
+YY_EXTRA_TYPE yyget_extra ( yyscan_t yyscanner );
+void yyset_extra ( YY_EXTRA_TYPE user_defined , yyscan_t yyscanner );
+FILE *yyget_in ( yyscan_t yyscanner );
+void yyset_in  ( FILE * _in_str , yyscan_t yyscanner );
+FILE *yyget_out ( yyscan_t yyscanner );
+void yyset_out  ( FILE * _out_str , yyscan_t yyscanner );
+int yyget_leng ( yyscan_t yyscanner );
+char *yyget_text ( yyscan_t yyscanner );
+int yyget_lineno ( yyscan_t yyscanner );
+void yyset_lineno ( int _line_number , yyscan_t yyscanner );
+int yyget_column  ( yyscan_t yyscanner );
+void yyset_column ( int _column_no , yyscan_t yyscanner );
+
+
+#ifndef YY_READ_BUF_SIZE
+#define YY_READ_BUF_SIZE 8192
+#endif
+
+#ifndef ECHO
+#define ECHO do { if (fwrite( yytext, (size_t) yyleng, 1, yyout )) {} } while (0)
+#endif
+
+#ifndef YY_INPUT
+#define YY_INPUT(buf,result,max_size) \
+	if ( YY_CURRENT_BUFFER_LVALUE->yy_is_interactive ) \
+		{ \
+		int c = '*'; \
+		int n; \
+		for ( n = 0; n < max_size && \
+			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
+			buf[n] = (char) c; \
+		if ( c == '\n' ) \
+			buf[n++] = (char) c; \
+		if ( c == EOF && ferror( yyin ) ) \
+			YY_FATAL_ERROR( "input in flex scanner failed" ); \
+		result = n; \
+		} \
+	else \
+		{ \
+		errno=0; \
+		while ( (result = (int) fread(buf, 1, (yy_size_t) max_size, yyin)) == 0 && ferror(yyin)) \
+			{ \
+			if( errno != EINTR) \
+				{ \
+				YY_FATAL_ERROR( "input in flex scanner failed" ); \
+				break; \
+				} \
+			errno=0; \
+			clearerr(yyin); \
+			} \
+		}\
+
+#endif
+
+#ifndef yyterminate
+#define yyterminate() return YY_NULL
+#endif
+
+#ifndef YY_START_STACK_INCR
+#define YY_START_STACK_INCR 25
+#endif
+
+#ifndef YY_FATAL_ERROR
+#define YY_FATAL_ERROR(msg) yy_fatal_error( msg , yyscanner)
+#endif
+
+#ifndef YY_DECL
+#define YY_DECL_IS_OURS 1
+
+extern int yylex (yyscan_t yyscanner);
+
+#define YY_DECL int yylex (yyscan_t yyscanner)
+#endif /* !YY_DECL */
+
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+
+#ifndef YY_BREAK
+#define YY_BREAK /*LINTED*/break;
+#endif
+
+#define YY_RULE_SETUP \
+	YY_USER_ACTION
+
+
+/** The main scanner function which does all the work.
+ */
+YY_DECL
+{
+	yy_state_type yy_current_state;
+	char *yy_cp, *yy_bp;
+	int yy_act;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	if ( !yyg->yy_init )
+		{
+		yyg->yy_init = 1;
+
+#ifdef YY_USER_INIT
+		YY_USER_INIT;
+#endif
+
+		if ( ! yyg->yy_start )
+			yyg->yy_start = 1;	/* first start state */
+
+		if ( ! yyin )
+			yyin = stdin;
+
+		if ( ! yyout )
+			yyout = stdout;
+
+		if ( ! YY_CURRENT_BUFFER ) {
+			yyensure_buffer_stack (yyscanner);
+			YY_CURRENT_BUFFER_LVALUE =
+				yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner);
+		}
+
+		yy_load_buffer_state( yyscanner );
+		}
+
+	{
+#line 226 "cool.l"
+    LEXPROF_ENTER(&yyextra->prof);
+#line 716 "lex.yy.c"
+
+	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
+		{
+		yy_cp = yyg->yy_c_buf_p;
+
+		/* Support of yytext. */
+		*yy_cp = yyg->yy_hold_char;
+
+		/* yy_bp points to the position in yy_ch_buf of the start of
+		 * the current run.
+		 */
+		yy_bp = yy_cp;
+
+		yy_current_state = yyg->yy_start;
+yy_match:
+		while ( (yy_current_state = yy_nxt[yy_current_state][yy_ec[YY_SC_TO_UI(*yy_cp)]]) > 0 )
+			++yy_cp;
+
+		yy_current_state = -yy_current_state;
+
+yy_find_action:
+		yy_act = yy_accept[yy_current_state];
+		if ( yy_act == 0 )
+			{ /* have to back up */
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
+			yy_act = yy_accept[yy_current_state];
+			}
+
+		YY_DO_BEFORE_ACTION;
+
+do_action:	/* This label is used only to access EOF actions. */
+
+		switch ( yy_act )
+	{ /* beginning of action switch */
+			case 0: /* must back up */
+			/* undo the effects of YY_DO_BEFORE_ACTION */
+			*yy_cp = yyg->yy_hold_char;
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
+			goto yy_find_action;
+
+case 1:
+YY_RULE_SETUP
+#line 229 "cool.l"
+{ yyextra->comment_depth++; BEGIN(COMMENT); }
+	YY_BREAK
+case 2:
+YY_RULE_SETUP
+#line 231 "cool.l"
+{ yyextra->comment_depth++; }
+	YY_BREAK
+case 3:
+YY_RULE_SETUP
+#line 233 "cool.l"
+{ SKIP_TEXT(skip_comment_text); /*주석 내부 문자 무시 */ }
+	YY_BREAK
+case 4:
+YY_RULE_SETUP
+#line 234 "cool.l"
+{ BAD_UTF8(); SKIP_TEXT(skip_comment_text); }
+	YY_BREAK
+case 5:
+YY_RULE_SETUP
+#line 235 "cool.l"
+{ /*짝이 없는 ( 와 * 무시 */ }
+	YY_BREAK
+case 6:
+YY_RULE_SETUP
+#line 236 "cool.l"
+{ yyextra->comment_depth--; if(yyextra->comment_depth ==0) BEGIN(INITIAL); }
+	YY_BREAK
+case 7:
+YY_RULE_SETUP
+#line 250 "cool.l"
+{ SPECULATION_FAIL();
+          if (yyextra->recover) {
+              add_diag(yyextra, yyextra->tokenOffset, "Unmatched *)", -1);
+              return ERROR;
+          }
+          LEX_ERROR("Unmatched *)");
+        }
+	YY_BREAK
+case 8:
+YY_RULE_SETUP
+#line 258 "cool.l"
+{ BEGIN(S_LINE_COMMENT); }
+	YY_BREAK
+case 9:
+YY_RULE_SETUP
+#line 260 "cool.l"
+{ SKIP_TEXT(skip_line_text); /*한줄 주석 무시*/ }
+	YY_BREAK
+case 10:
+YY_RULE_SETUP
+#line 261 "cool.l"
+{ BAD_UTF8(); SKIP_TEXT(skip_line_text); }
+	YY_BREAK
+case 11:
+YY_RULE_SETUP
+#line 262 "cool.l"
+{ BEGIN(INITIAL); }
+	YY_BREAK
+case 12:
+YY_RULE_SETUP
+#line 265 "cool.l"
+{ SKIP_TEXT(skip_space); }
+	YY_BREAK
+case 13:
+YY_RULE_SETUP
+#line 266 "cool.l"
+/* SKIP */
+	YY_BREAK
+case 14:
+YY_RULE_SETUP
+#line 269 "cool.l"
+{ int kw = keyword_lookup(yytext, yyleng); return kw ? kw : TYPE; }
+	YY_BREAK
+case 15:
+YY_RULE_SETUP
+#line 271 "cool.l"
+{ int kw = keyword_lookup(yytext, yyleng); return kw ? kw : ID; }
+	YY_BREAK
+case 16:
+YY_RULE_SETUP
+#line 273 "cool.l"
+{ return INTEGER; }
+	YY_BREAK
+case 17:
+YY_RULE_SETUP
+#line 276 "cool.l"
+{
+          if (skip_utf8(yytext + 1, yytext + yyleng - 1) != yytext + yyleng - 1) {
+              SPECULATION_FAIL();
+              check_string_utf8(yyextra, yytext + 1, yyleng - 2, yyextra->tokenOffset + 1);
+          }
+          return STRING;
+        }
+	YY_BREAK
+case 18:
+YY_RULE_SETUP
+#line 288 "cool.l"
+{
+          yyless(1);
+          yyextra->nextOffset = yyextra->tokenOffset + 1;
+          INVALID_CHAR();
+        }
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+#line 294 "cool.l"
+{ return LPAREN; }
+	YY_BREAK
+case 20:
+YY_RULE_SETUP
+#line 295 "cool.l"
+{ return RPAREN; }
+	YY_BREAK
+case 21:
+YY_RULE_SETUP
+#line 296 "cool.l"
+{ return LBRACE; }
+	YY_BREAK
+case 22:
+YY_RULE_SETUP
+#line 297 "cool.l"
+{ return RBRACE; }
+	YY_BREAK
+case 23:
+YY_RULE_SETUP
+#line 298 "cool.l"
+{ return LTE; }
+	YY_BREAK
+case 24:
+YY_RULE_SETUP
+#line 299 "cool.l"
+{ return ASSIGN; }
+	YY_BREAK
+case 25:
+YY_RULE_SETUP
+#line 300 "cool.l"
+{ return LT; }
+	YY_BREAK
+case 26:
+YY_RULE_SETUP
+#line 301 "cool.l"
+{ return DARROW; }
+	YY_BREAK
+case 27:
+YY_RULE_SETUP
+#line 302 "cool.l"
+{ return EQUAL; }
+	YY_BREAK
+case 28:
+YY_RULE_SETUP
+#line 303 "cool.l"
+{ return COMMA; }
+	YY_BREAK
+case 29:
+YY_RULE_SETUP
+#line 304 "cool.l"
+{ return SEMICOLON; }
+	YY_BREAK
+case 30:
+YY_RULE_SETUP
+#line 305 "cool.l"
+{ return COLON; }
+	YY_BREAK
+case 31:
+YY_RULE_SETUP
+#line 306 "cool.l"
+{ return DOT; }
+	YY_BREAK
+case 32:
+YY_RULE_SETUP
+#line 307 "cool.l"
+{ return PLUS; }
+	YY_BREAK
+case 33:
+YY_RULE_SETUP
+#line 308 "cool.l"
+{ return MINUS; }
+	YY_BREAK
+case 34:
+YY_RULE_SETUP
+#line 309 "cool.l"
+{ return MUL; }
+	YY_BREAK
+case 35:
+YY_RULE_SETUP
+#line 310 "cool.l"
+{ return DIV; }
+	YY_BREAK
+case 36:
+YY_RULE_SETUP
+#line 311 "cool.l"
+{ return NEG; }
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+#line 312 "cool.l"
+{ return ATSIGN; }
+	YY_BREAK
+case 38:
+YY_RULE_SETUP
+#line 313 "cool.l"
+{ INVALID_CHAR(); }
+	YY_BREAK
+case 39:
+YY_RULE_SETUP
+#line 967 "lex.yy.c"
+ECHO;
+	YY_BREAK
+case YY_STATE_EOF(COMMENT):
+#line 239 "cool.l"
+{ SPECULATION_FAIL();
+                      if (yyextra->recover) {
+                          yyextra->tokenOffset = yyextra->nextOffset;
+                          add_diag(yyextra, yyextra->tokenOffset, "EOF in comment", -1);
+                          yyextra->comment_depth = 0;
+                          BEGIN(INITIAL);
+                          return ERROR;
+                      }
+                      LEX_ERROR("EOF in comment");
+                    }
+	YY_BREAK
+case YY_STATE_EOF(INITIAL):
+case YY_STATE_EOF(S_LINE_COMMENT):
+	yyterminate();
+#line 986 "lex.yy.c"
+
+	case YY_END_OF_BUFFER:
+		{
+		/* Amount of text matched not including the EOB char. */
+		int yy_amount_of_matched_text = (int) (yy_cp - yyg->yytext_ptr) - 1;
+
+		/* Undo the effects of YY_DO_BEFORE_ACTION. */
+		*yy_cp = yyg->yy_hold_char;
+		YY_RESTORE_YY_MORE_OFFSET
+
+		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
+			{
+			yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
+			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
+			}
+
+		if ( yyg->yy_c_buf_p <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] )
+			{ /* This was really a NUL. */
+			yy_state_type yy_next_state;
+
+			yyg->yy_c_buf_p = yyg->yytext_ptr + yy_amount_of_matched_text;
+
+			yy_current_state = yy_get_previous_state( yyscanner );
+
+			yy_next_state = yy_try_NUL_trans( yy_current_state , yyscanner);
+
+			yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
+
+			if ( yy_next_state )
+				{
+				/* Consume the NUL. */
+				yy_cp = ++yyg->yy_c_buf_p;
+				yy_current_state = yy_next_state;
+				goto yy_match;
+				}
+
+			else
+				{
+				yy_cp = yyg->yy_c_buf_p;
+				goto yy_find_action;
+				}
+			}
+
+		else switch ( yy_get_next_buffer( yyscanner ) )
+			{
+			case EOB_ACT_END_OF_FILE:
+				{
+				yyg->yy_did_buffer_switch_on_eof = 0;
+
+				if ( yywrap( yyscanner ) )
+					{
+					yyg->yy_c_buf_p = yyg->yytext_ptr + YY_MORE_ADJ;
+
+					yy_act = YY_STATE_EOF(YY_START);
+					goto do_action;
+					}
+
+				else
+					{
+					if ( ! yyg->yy_did_buffer_switch_on_eof )
+						YY_NEW_FILE;
+					}
+				break;
+				}
+
+			case EOB_ACT_CONTINUE_SCAN:
+				yyg->yy_c_buf_p =
+					yyg->yytext_ptr + yy_amount_of_matched_text;
+
+				yy_current_state = yy_get_previous_state( yyscanner );
+
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
+				goto yy_match;
+
+			case EOB_ACT_LAST_MATCH:
+				yyg->yy_c_buf_p =
+				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars];
+
+				yy_current_state = yy_get_previous_state( yyscanner );
+
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
+				goto yy_find_action;
+			}
+		break;
+		}
+
+	default:
+		YY_FATAL_ERROR(
+			"fatal flex scanner internal error--no action found" );
+	} /* end of action switch */
+		} /* end of scanning one token */
+	} /* end of user's declarations */
+} /* end of yylex */
+
+
+static int yy_get_next_buffer (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
+	char *source = yyg->yytext_ptr;
+	int number_to_move, i;
+	int ret_val;
+
+	if ( yyg->yy_c_buf_p > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] )
+		YY_FATAL_ERROR(
+		"fatal flex scanner internal error--end of buffer missed" );
+
+	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
+		{ /* Don't try to fill the buffer, so this is an EOF. */
+		if ( yyg->yy_c_buf_p - yyg->yytext_ptr - YY_MORE_ADJ == 1 )
+			{
+			return EOB_ACT_END_OF_FILE;
+			}
+
+		else
+			{
+			return EOB_ACT_LAST_MATCH;
+			}
+		}
+
+	/* Try to read more data. */
+
+	/* First move last chars to start of buffer. */
+	number_to_move = (int) (yyg->yy_c_buf_p - yyg->yytext_ptr - 1);
+
+	for ( i = 0; i < number_to_move; ++i )
+		*(dest++) = *(source++);
+
+	if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_EOF_PENDING )
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars = 0;
+
+	else
+		{
+			int num_to_read =
+			YY_CURRENT_BUFFER_LVALUE->yy_buf_size - number_to_move - 1;
+
+		while ( num_to_read <= 0 )
+			{ /* Not enough room in the buffer - grow it. */
+
+			/* just a shorter name for the current buffer */
+			YY_BUFFER_STATE b = YY_CURRENT_BUFFER_LVALUE;
+
+			int yy_c_buf_p_offset =
+				(int) (yyg->yy_c_buf_p - b->yy_ch_buf);
+
+			if ( b->yy_is_our_buffer )
+				{
+				int new_size = b->yy_buf_size * 2;
+
+				if ( new_size <= 0 )
+					b->yy_buf_size += b->yy_buf_size / 8;
+				else
+					b->yy_buf_size *= 2;
+
+				b->yy_ch_buf = (char *)
+					/* Include room in for 2 EOB chars. */
+					yyrealloc( (void *) b->yy_ch_buf,
+							 (yy_size_t) (b->yy_buf_size + 2) , yyscanner );
+				}
+			else
+				/* Can't grow it, we don't own it. */
+				b->yy_ch_buf = NULL;
+
+			if ( ! b->yy_ch_buf )
+				YY_FATAL_ERROR(
+				"fatal error - scanner input buffer overflow" );
+
+			yyg->yy_c_buf_p = &b->yy_ch_buf[yy_c_buf_p_offset];
+
+			num_to_read = YY_CURRENT_BUFFER_LVALUE->yy_buf_size -
+						number_to_move - 1;
+
+			}
+
+		if ( num_to_read > YY_READ_BUF_SIZE )
+			num_to_read = YY_READ_BUF_SIZE;
+
+		/* Read in more data. */
+		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
+			yyg->yy_n_chars, num_to_read );
+
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
+		}
+
+	if ( yyg->yy_n_chars == 0 )
+		{
+		if ( number_to_move == YY_MORE_ADJ )
+			{
+			ret_val = EOB_ACT_END_OF_FILE;
+			yyrestart( yyin  , yyscanner);
+			}
+
+		else
+			{
+			ret_val = EOB_ACT_LAST_MATCH;
+			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status =
+				YY_BUFFER_EOF_PENDING;
+			}
+		}
+
+	else
+		ret_val = EOB_ACT_CONTINUE_SCAN;
+
+	if ((yyg->yy_n_chars + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
+		/* Extend the array by 50%, plus the number we really need. */
+		int new_size = yyg->yy_n_chars + number_to_move + (yyg->yy_n_chars >> 1);
+		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) yyrealloc(
+			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size , yyscanner );
+		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
+			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
+		/* "- 2" to take care of EOB's */
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_size = (int) (new_size - 2);
+	}
+
+	yyg->yy_n_chars += number_to_move;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] = YY_END_OF_BUFFER_CHAR;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] = YY_END_OF_BUFFER_CHAR;
+
+	yyg->yytext_ptr = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
+
+	return ret_val;
+}
+
+/* yy_get_previous_state - get the state just before the EOB char was reached */
+
+    static yy_state_type yy_get_previous_state (yyscan_t yyscanner)
+{
+	yy_state_type yy_current_state;
+	char *yy_cp;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	yy_current_state = yyg->yy_start;
+
+	for ( yy_cp = yyg->yytext_ptr + YY_MORE_ADJ; yy_cp < yyg->yy_c_buf_p; ++yy_cp )
+		{
+		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : YY_NUL_EC);
+		yy_current_state = yy_nxt[yy_current_state][yy_c];
+		}
+
+	return yy_current_state;
+}
+
+    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state , yyscan_t yyscanner)
+{
+	int yy_is_jam;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner; /* This var may be unused depending upon options. */
+	char *yy_cp = yyg->yy_c_buf_p;
+
+	YY_CHAR yy_c = YY_NUL_EC;
+	yy_current_state = yy_nxt[yy_current_state][yy_c];
+	yy_is_jam = (yy_current_state <= 0);
+
+	(void)yy_cp;
+
+	(void)yyg;
+	return yy_is_jam ? 0 : yy_current_state;
+}
+
+    void yyrestart  (FILE * input_file , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	if ( ! YY_CURRENT_BUFFER ){
+        yyensure_buffer_stack (yyscanner);
+		YY_CURRENT_BUFFER_LVALUE =
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner);
+	}
+
+	yy_init_buffer( YY_CURRENT_BUFFER, input_file , yyscanner);
+	yy_load_buffer_state( yyscanner );
+}
+
+    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	yyensure_buffer_stack (yyscanner);
+	if ( YY_CURRENT_BUFFER == new_buffer )
+		return;
+
+	if ( YY_CURRENT_BUFFER )
+		{
+		/* Flush out information for old buffer. */
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
+		}
+
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+	yy_load_buffer_state( yyscanner );
+
+	yyg->yy_did_buffer_switch_on_eof = 1;
+}
+
+static void yy_load_buffer_state  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+	yyg->yytext_ptr = yyg->yy_c_buf_p = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
+	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
+	yyg->yy_hold_char = *yyg->yy_c_buf_p;
+}
+
+    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size , yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b;
+
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state ) , yyscanner );
+	if ( ! b )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
+
+	b->yy_buf_size = size;
+
+	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2) , yyscanner );
+	if ( ! b->yy_ch_buf )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
+
+	b->yy_is_our_buffer = 1;
+
+	yy_init_buffer( b, file , yyscanner);
+
+	return b;
+}
+
+    void yy_delete_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	if ( ! b )
+		return;
+
+	if ( b == YY_CURRENT_BUFFER ) /* Not sure if we should pop here. */
+		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
+
+	if ( b->yy_is_our_buffer )
+		yyfree( (void *) b->yy_ch_buf , yyscanner );
+
+	yyfree( (void *) b , yyscanner );
+}
+
+    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file , yyscan_t yyscanner)
+
+{
+	int oerrno = errno;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	yy_flush_buffer( b , yyscanner);
+
+	b->yy_input_file = file;
+	b->yy_fill_buffer = 1;
+
+    if (b != YY_CURRENT_BUFFER){
+        b->yy_bs_lineno = 1;
+        b->yy_bs_column = 0;
+    }
+
+        b->yy_is_interactive = file ? (isatty( fileno(file) ) > 0) : 0;
+
+	errno = oerrno;
+}
+
+    void yy_flush_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if ( ! b )
+		return;
+
+	b->yy_n_chars = 0;
+
+	b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
+	b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
+
+	b->yy_buf_pos = &b->yy_ch_buf[0];
+
+	b->yy_at_bol = 1;
+	b->yy_buffer_status = YY_BUFFER_NEW;
+
+	if ( b == YY_CURRENT_BUFFER )
+		yy_load_buffer_state( yyscanner );
+}
+
+void yypush_buffer_state (YY_BUFFER_STATE new_buffer , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (new_buffer == NULL)
+		return;
+
+	yyensure_buffer_stack(yyscanner);
+
+	if ( YY_CURRENT_BUFFER )
+		{
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
+		}
+
+	if (YY_CURRENT_BUFFER)
+		yyg->yy_buffer_stack_top++;
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+
+	yy_load_buffer_state( yyscanner );
+	yyg->yy_did_buffer_switch_on_eof = 1;
+}
+
+void yypop_buffer_state (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (!YY_CURRENT_BUFFER)
+		return;
+
+	yy_delete_buffer(YY_CURRENT_BUFFER , yyscanner);
+	YY_CURRENT_BUFFER_LVALUE = NULL;
+	if (yyg->yy_buffer_stack_top > 0)
+		--yyg->yy_buffer_stack_top;
+
+	if (YY_CURRENT_BUFFER) {
+		yy_load_buffer_state( yyscanner );
+		yyg->yy_did_buffer_switch_on_eof = 1;
+	}
+}
+
+static void yyensure_buffer_stack (yyscan_t yyscanner)
+{
+	yy_size_t num_to_alloc;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	if (!yyg->yy_buffer_stack) {
+      num_to_alloc = 1;
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)yyalloc
+								(num_to_alloc * sizeof(struct yy_buffer_state*)
+								, yyscanner);
+		if ( ! yyg->yy_buffer_stack )
+			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
+
+		memset(yyg->yy_buffer_stack, 0, num_to_alloc * sizeof(struct yy_buffer_state*));
+
+		yyg->yy_buffer_stack_max = num_to_alloc;
+		yyg->yy_buffer_stack_top = 0;
+		return;
+	}
+
+	if (yyg->yy_buffer_stack_top >= (yyg->yy_buffer_stack_max) - 1){
+		yy_size_t grow_size = 8 /* arbitrary grow size */;
+
+		num_to_alloc = yyg->yy_buffer_stack_max + grow_size;
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)yyrealloc
+								(yyg->yy_buffer_stack,
+								num_to_alloc * sizeof(struct yy_buffer_state*)
+								, yyscanner);
+		if ( ! yyg->yy_buffer_stack )
+			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
+
+		memset(yyg->yy_buffer_stack + yyg->yy_buffer_stack_max, 0, grow_size * sizeof(struct yy_buffer_state*));
+		yyg->yy_buffer_stack_max = num_to_alloc;
+	}
+}
+
+YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size , yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b;
+
+	if ( size < 2 ||
+	     base[size-2] != YY_END_OF_BUFFER_CHAR ||
+	     base[size-1] != YY_END_OF_BUFFER_CHAR )
+		/* They forgot to leave room for the EOB's. */
+		return NULL;
+
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state ) , yyscanner );
+	if ( ! b )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
+
+	b->yy_buf_size = (int) (size - 2);	/* "- 2" to take care of EOB's */
+	b->yy_buf_pos = b->yy_ch_buf = base;
+	b->yy_is_our_buffer = 0;
+	b->yy_input_file = NULL;
+	b->yy_n_chars = b->yy_buf_size;
+	b->yy_is_interactive = 0;
+	b->yy_at_bol = 1;
+	b->yy_fill_buffer = 0;
+	b->yy_buffer_status = YY_BUFFER_NEW;
+
+	yy_switch_to_buffer( b , yyscanner );
+
+	return b;
+}
+
+YY_BUFFER_STATE yy_scan_string (const char * yystr , yyscan_t yyscanner)
+{
+
+	return yy_scan_bytes( yystr, (int) strlen(yystr) , yyscanner);
+}
+
+YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len , yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b;
+	char *buf;
+	yy_size_t n;
+	int i;
+
+	n = (yy_size_t) (_yybytes_len + 2);
+	buf = (char *) yyalloc( n , yyscanner );
+	if ( ! buf )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
+
+	for ( i = 0; i < _yybytes_len; ++i )
+		buf[i] = yybytes[i];
+
+	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
+
+	b = yy_scan_buffer( buf, n , yyscanner);
+	if ( ! b )
+		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
+
+	b->yy_is_our_buffer = 1;
+
+	return b;
+}
+
+#ifndef YY_EXIT_FAILURE
+#define YY_EXIT_FAILURE 2
+#endif
+
+static void yynoreturn yy_fatal_error (const char* msg , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	fprintf( stderr, "%s\n", msg );
+	exit( YY_EXIT_FAILURE );
+}
+
+/* Redefine yyless() so it works in section 3 code. */
+
+#undef yyless
+#define yyless(n) \
+	do \
+		{ \
+		/* Undo effects of setting up yytext. */ \
+        int yyless_macro_arg = (n); \
+        YY_LESS_LINENO(yyless_macro_arg);\
+		yytext[yyleng] = yyg->yy_hold_char; \
+		yyg->yy_c_buf_p = yytext + yyless_macro_arg; \
+		yyg->yy_hold_char = *yyg->yy_c_buf_p; \
+		*yyg->yy_c_buf_p = '\0'; \
+		yyleng = yyless_macro_arg; \
+		} \
+	while ( 0 )
+
+YY_EXTRA_TYPE yyget_extra  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyextra;
+}
+
+int yyget_lineno  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+
+    return yylineno;
+}
+
+int yyget_column  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+
+    return yycolumn;
+}
+
+FILE *yyget_in  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyin;
+}
+
+FILE *yyget_out  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyout;
+}
+
+int yyget_leng  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyleng;
+}
+
+char *yyget_text  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yytext;
+}
+
+void yyset_extra (YY_EXTRA_TYPE  user_defined , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyextra = user_defined ;
+}
+
+void yyset_lineno (int  _line_number , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER )
+           YY_FATAL_ERROR( "yyset_lineno called with no buffer" );
+
+    yylineno = _line_number;
+}
+
+void yyset_column (int  _column_no , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER )
+           YY_FATAL_ERROR( "yyset_column called with no buffer" );
+
+    yycolumn = _column_no;
+}
+
+void yyset_in (FILE *  _in_str , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyin = _in_str ;
+}
+
+void yyset_out (FILE *  _out_str , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyout = _out_str ;
+}
+
+int yyget_debug  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yy_flex_debug;
+}
+
+void yyset_debug (int  _bdebug , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yy_flex_debug = _bdebug ;
+}
+
+int yylex_init(yyscan_t* ptr_yy_globals)
+{
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) yyalloc ( sizeof( struct yyguts_t ), NULL );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    return yy_init_globals ( *ptr_yy_globals );
+}
+
+int yylex_init_extra( YY_EXTRA_TYPE yy_user_defined, yyscan_t* ptr_yy_globals )
+{
+    struct yyguts_t dummy_yyguts;
+
+    yyset_extra (yy_user_defined, &dummy_yyguts);
+
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) yyalloc ( sizeof( struct yyguts_t ), &dummy_yyguts );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    yyset_extra (yy_user_defined, *ptr_yy_globals);
+
+    return yy_init_globals ( *ptr_yy_globals );
+}
+
+static int yy_init_globals (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+    yyg->yy_buffer_stack = NULL;
+    yyg->yy_buffer_stack_top = 0;
+    yyg->yy_buffer_stack_max = 0;
+    yyg->yy_c_buf_p = NULL;
+    yyg->yy_init = 0;
+    yyg->yy_start = 0;
+
+    yyg->yy_start_stack_ptr = 0;
+    yyg->yy_start_stack_depth = 0;
+    yyg->yy_start_stack =  NULL;
+
+    yyin = NULL;
+    yyout = NULL;
+
+    return 0;
+}
+
+int yylex_destroy  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	while(YY_CURRENT_BUFFER){
+		yy_delete_buffer( YY_CURRENT_BUFFER , yyscanner );
+		YY_CURRENT_BUFFER_LVALUE = NULL;
+		yypop_buffer_state(yyscanner);
+	}
+
+	yyfree(yyg->yy_buffer_stack , yyscanner);
+	yyg->yy_buffer_stack = NULL;
+
+    yyfree( yyg->yy_start_stack , yyscanner );
+    yyg->yy_start_stack = NULL;
+
+    yy_init_globals( yyscanner);
+
+    yyfree ( yyscanner , yyscanner );
+    yyscanner = NULL;
+    return 0;
+}
+
+void *yyalloc (yy_size_t  size , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	return malloc(size);
+}
+
+void *yyrealloc  (void * ptr, yy_size_t  size , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	return realloc(ptr, size);
+}
+
+void yyfree (void * ptr , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
+}
+
+#define YYTABLES_NAME "yytables"
+
+#line 316 "cool.l"
+
+_Static_assert(YY_NUM_RULES < LEXPROF_MAX_RULES, "LEXPROF_MAX_RULES is too small");
+
+/* 스캐너 인스턴스를 만든다 */
+static cool_lexer_t *lexer_new(void)
+{
+    cool_lexer_t *lx = calloc(1, sizeof(cool_lexer_t));
+
+    if (!lx)
+        return NULL;
+    lineidx_init(&lx->lines, 0, 1);
+    lx->limit = SIZE_MAX;
+    if (yylex_init_extra(lx, &lx->scanner) != 0) {
+        free(lx);
+        return NULL;
+    }
+    LEXPROF_OPEN(&lx->prof, ((const char *[]){ "INITIAL", "COMMENT", "S_LINE_COMMENT" }), 3);
+    return lx;
+}
+
+/*
+ * 일반 파일을 mmap으로 매핑하여 flex 버퍼로 직접 스캔한다.
+ * yy_scan_buffer()는 버퍼 끝에 YY_END_OF_BUFFER_CHAR 두 개를 요구하므로
+ * 스캔할 범위보다 두 바이트 이상 큰 익명 영역을 먼저 잡고 그 위에 파일을 겹쳐 매핑한다.
+ * flex는 yytext를 만들 때 버퍼에 '\0'을 쓰기 때문에 MAP_PRIVATE로 쓰기를 허용한다.
+ * 매핑할 수 없으면(파이프, 표준입력, 빈 파일 등) 0을 돌려주고 기존 스트림 방식을 쓴다.
+ * start는 스캔을 시작할 파일 안의 바이트 오프셋이고, limit 이후에서 시작하는 렉심 앞에서
+ * 멈출 스캔이면 limit 뒤로 가장 긴 렉심만큼만 flex 버퍼에 넘긴다. flex는 버퍼 크기를
+ * int로 다루므로 넘길 범위가 COOL_LEX_MAX_RANGE보다 크면 매핑하지 않는다.
+ * 쓰기 가능한 매핑은 그 크기만큼 메모리를 예약하므로 파일 전체가 아니라 start가 든
+ * 페이지부터 넘길 범위의 끝까지만 매핑한다. buf_off는 그 첫 바이트의 파일 오프셋이다.
+ */
+static int map_input(cool_lexer_t *lx, int fd, size_t start, size_t limit)
+{
+    struct stat st;
+    size_t size, end, off, flen, len;
+    long page;
+    char *base;
+
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size == 0)
+        return 0;
+    size = (size_t)st.st_size;
+    if (start > size)
+        return 0;
+    /* limit 앞에서 시작한 렉심이 end에 닿으면 COOL_LEX_MAX_TOKEN보다 길어 오류가 된다 */
+    end = size;
+    if (limit < size && size - limit > COOL_LEX_MAX_TOKEN + 1)
+        end = limit + COOL_LEX_MAX_TOKEN + 1;
+    if (end - start > COOL_LEX_MAX_RANGE)
+        return 0;
+    page = sysconf(_SC_PAGESIZE);
+    off = start - start % (size_t)page;
+    flen = (end + 2 < size ? end + 2 : size) - off;
+    len = (end + 2 - off + page - 1) / page * page;
+    base = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return 0;
+    if (flen > 0 && mmap(base, flen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd,
+                         (off_t)off) == MAP_FAILED) {
+        munmap(base, len);
+        return 0;
+    }
+    madvise(base, len, MADV_SEQUENTIAL);
+    /* 파일 끝 이후의 바이트는 0으로 채워져 있으므로 그대로 센티널이 된다 */
+    if (end < size)
+        base[end - off] = base[end + 1 - off] = YY_END_OF_BUFFER_CHAR;
+    if (!yy_scan_buffer(base + (start - off), end - start + 2, lx->scanner)) {
+        munmap(base, len);
+        return 0;
+    }
+    lx->buf = base;
+    lx->buf_off = off;
+    lx->buf_len = len;
+    lx->mapped = 1;
+    return 1;
+}
+
+/*
+ * 메모리에 있는 소스를 스캔한다. flex가 버퍼에 쓰기 때문에 센티널을 붙인 복사본을 만든다.
+ */
+cool_lexer_t *cool_lexer_open_buffer(const char *buf, size_t len)
+{
+    cool_lexer_t *lx = lexer_new();
+
+    if (!lx)
+        return NULL;
+    if (len > COOL_LEX_MAX_RANGE || !(lx->buf = malloc(len + 2))) {
+        cool_lexer_close(lx);
+        return NULL;
+    }
+    memcpy(lx->buf, buf, len);
+    lx->buf[len] = lx->buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+    lx->buf_len = len + 2;
+    if (!yy_scan_buffer(lx->buf, len + 2, lx->scanner)) {
+        cool_lexer_close(lx);
+        return NULL;
+    }
+    return lx;
+}
+
+/*
+ * 스트림을 COOL_LEX_WINDOW 크기의 flex 버퍼로 읽는다. 버퍼는 가장 긴 렉심을 담아야 할
+ * 때만 자라며(COOL_LEX_MAX_TOKEN까지), yylex_destroy()가 해제한다.
+ */
+static int read_stream(cool_lexer_t *lx, FILE *fp)
+{
+    YY_BUFFER_STATE b = yy_create_buffer(fp, COOL_LEX_WINDOW, lx->scanner);
+
+    if (!b)
+        return 0;
+    yy_switch_to_buffer(b, lx->scanner);
+    return 1;
+}
+
+/*
+ * 입력 파일을 연다. 일반 파일은 mmap 경로를, 그 밖에는 스트림 경로를 사용한다.
+ * 파일을 열 수 없으면 NULL을 돌려준다.
+ */
+cool_lexer_t *cool_lexer_open_file(const char *path)
+{
+    cool_lexer_t *lx;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return NULL;
+    if (!(lx = lexer_new())) {
+        close(fd);
+        return NULL;
+    }
+    if (map_input(lx, fd, 0, SIZE_MAX)) {
+        close(fd);
+        return lx;
+    }
+    if (!(lx->fp = fdopen(fd, "r"))) {
+        close(fd);
+        cool_lexer_close(lx);
+        return NULL;
+    }
+    if (!read_stream(lx, lx->fp)) {
+        cool_lexer_close(lx);
+        return NULL;
+    }
+    return lx;
+}
+
+/* start 오프셋, line번째 줄, state 상태(주석이면 깊이 depth)에서 스캔을 시작하도록 한다 */
+static void start_at(cool_lexer_t *lx, size_t start, size_t line, int state, int depth)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)lx->scanner;
+
+    lineidx_init(&lx->lines, start, line);
+    lx->comment_depth = depth;
+    lx->nextOffset = start;
+    if (state == COOL_LEX_COMMENT)
+        BEGIN(COMMENT);
+    else if (state == COOL_LEX_LINE_COMMENT)
+        BEGIN(S_LINE_COMMENT);
+    else
+        BEGIN(INITIAL);
+}
+
+/*
+ * 일반 파일의 일부 구간을 스캔한다. start부터 line번째 줄, state 상태(주석이면 깊이 depth)로
+ * 스캔을 시작하고, limit 이후에서 시작하는 첫 렉심 앞에서 멈춘다. 마지막 렉심이 limit을
+ * 넘어 끝날 수 있으므로 구간 끝에서 입력을 자르지 않고 가장 긴 렉심만큼 더 넘긴다.
+ * 그 범위가 COOL_LEX_MAX_RANGE보다 커서 한 flex 버퍼에 담을 수 없으면 NULL을 돌려준다.
+ * 멈춘 위치와 상태는 nextOffset, cool_lexer_line(), comment_depth와 cool_lexer_state()로 얻는다.
+ */
+cool_lexer_t *cool_lexer_open_range(int fd, size_t start, size_t limit,
+                                    size_t line, int state, int depth)
+{
+    cool_lexer_t *lx = lexer_new();
+
+    if (!lx)
+        return NULL;
+    if (!map_input(lx, fd, start, limit)) {
+        cool_lexer_close(lx);
+        return NULL;
+    }
+    start_at(lx, start, line, state, depth);
+    lx->limit = limit;
+    return lx;
+}
+
+/*
+ * 메모리에 있는 소스 buf를 복사하지 않고 start부터 line번째 줄, INITIAL 상태로 스캔한다.
+ * buf[len]과 buf[len + 1]은 YY_END_OF_BUFFER_CHAR이어야 한다. flex는 렉심 뒤의 한 바이트를
+ * 잠시 '\0'으로 바꿔 두므로 cool_lexer_close()에서 되돌려 놓는다.
+ */
+cool_lexer_t *cool_lexer_open_mem(char *buf, size_t len, size_t start, size_t line)
+{
+    cool_lexer_t *lx = lexer_new();
+
+    if (!lx)
+        return NULL;
+    if (len - start > COOL_LEX_MAX_RANGE ||
+        !yy_scan_buffer(buf + start, len - start + 2, lx->scanner)) {
+        cool_lexer_close(lx);
+        return NULL;
+    }
+    lx->buf = buf;
+    lx->borrowed = 1;
+    start_at(lx, start, line, COOL_LEX_INITIAL, 0);
+    return lx;
+}
+
+/* 현재 스캔 상태(COOL_LEX_*)를 돌려준다 */
+int cool_lexer_state(cool_lexer_t *lx)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)lx->scanner;
+
+    switch (YY_START) {
+    case COMMENT:
+        return COOL_LEX_COMMENT;
+    case S_LINE_COMMENT:
+        return COOL_LEX_LINE_COMMENT;
+    default:
+        return COOL_LEX_INITIAL;
+    }
+}
+
+/*
+ * offset이 있는 줄번호를 돌려준다. 버퍼 입력은 아직 색인하지 않은 구간을 이때 색인한다.
+ * offset은 이미 스캔한 위치(토큰의 시작이나 nextOffset)여야 한다.
+ */
+size_t cool_lexer_line(cool_lexer_t *lx, size_t offset)
+{
+    lineidx_t *ix = &lx->lines;
+
+    if (lx->buf && offset > ix->end &&
+        lineidx_add(ix, lx->buf + (ix->end - lx->buf_off), offset - ix->end) < 0) {
+        perror("cool_lexer");
+        exit(1);
+    }
+    return lineidx_line(ix, offset);
+}
+
+/* 이미 열려 있는 스트림(예: 표준입력)을 스캔한다. 스트림은 닫지 않는다 */
+cool_lexer_t *cool_lexer_open_stream(FILE *fp)
+{
+    cool_lexer_t *lx = lexer_new();
+
+    if (lx && !read_stream(lx, fp)) {
+        cool_lexer_close(lx);
+        return NULL;
+    }
+    return lx;
+}
+
+/*
+ * 다음 토큰을 인식하여 tok에 채운다. 토큰 값을 돌려주며 입력의 끝이면 YY_NULL(0)이다.
+ * 길이는 오프셋의 차이로 구한다. 입력 끝의 ERROR 토큰은 yyleng이 의미가 없고 길이가 0이다.
+ */
+int cool_lexer_next(cool_lexer_t *lx, cool_token_t *tok)
+{
+    int kind = yylex(lx->scanner);
+
+    if (lx->errmsg[0])          /* deferred에서 오류로 멈췄다 */
+        return YY_NULL;
+    if (kind != YY_NULL && tok) {
+        tok->kind = kind;
+        tok->line = cool_lexer_line(lx, lx->tokenOffset);
+        tok->offset = lx->tokenOffset;
+        tok->len = lx->nextOffset - lx->tokenOffset;
+        tok->text = yyget_text(lx->scanner);
+    }
+    return kind;
+}
+
+void cool_lexer_close(cool_lexer_t *lx)
+{
+    if (!lx)
+        return;
+    LEXPROF_CLOSE(&lx->prof);
+    if (lx->borrowed) {
+        struct yyguts_t *yyg = (struct yyguts_t *)lx->scanner;
+        if (yyg->yy_c_buf_p)
+            *yyg->yy_c_buf_p = yyg->yy_hold_char;
+    }
+    yylex_destroy(lx->scanner);
+    if (lx->mapped)
+        munmap(lx->buf, lx->buf_len);
+    else if (!lx->borrowed)
+        free(lx->buf);
+    lineidx_free(&lx->lines);
+    free(lx->diags);
+    if (lx->fp)
+        fclose(lx->fp);
+    free(lx);
+}
+
+/* 토큰 값의 이름을 돌려준다 */
+const char *cool_token_name(int kind)
+{
+    return tokenName[kind-100];
+}
+
+/*
+ * 입력 끝까지 토큰을 인식하여 줄번호, 타입, 문자열(lexeme)을 out에 출력한다.
+ */
+void cool_lexer_dump(cool_lexer_t *lx, outbuf_t *out)
+{
+    size_t nameLen[sizeof(tokenName) / sizeof(tokenName[0])];
+    size_t i;
+    cool_token_t tok;
+
+    for (i = 0; i < sizeof(nameLen) / sizeof(nameLen[0]); i++)
+        nameLen[i] = strlen(tokenName[i]);
+    while (cool_lexer_next(lx, &tok) != YY_NULL)
+        outbuf_token(out, tok.line, tokenName[tok.kind-100], nameLen[tok.kind-100],
+                     tok.text, tok.len);
+}
+
+/*
+ * 입력 끝까지 토큰을 인식하여 이진 토큰 스트림(.cltok)으로 out에 출력한다.
+ */
+void cool_lexer_dump_bin(cool_lexer_t *lx, outbuf_t *out)
+{
+    cltok_writer_t bin;
+    cool_token_t tok;
+
+    cltok_write_begin(&bin, out);
+    while (cool_lexer_next(lx, &tok) != YY_NULL)
+        cltok_write_token(&bin, tok.kind, tok.line, tok.offset, tok.len);
+    cltok_write_end(&bin);
+}
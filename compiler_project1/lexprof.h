@@ -0,0 +1,65 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 스캐너 규칙별 프로파일.
+ *
+ * COOL_LEX_PROFILE을 정의하고 빌드하면(make profile) flex 규칙마다 인식한 횟수와
+ * 소비한 바이트 수를, 시작 조건마다 렉심을 인식하는 데 걸린 시간을 세어
+ * 프로그램이 끝날 때 표준오류에 표로 출력한다. 어휘 오류로 exit()하는 경우에도
+ * 아직 닫지 않은 스캐너의 값까지 더해 출력한다. 시간은 yylex()에 들어오거나 직전
+ * 규칙을 인식한 때부터 다음 규칙을 인식할 때까지를 그 규칙의 시작 조건에 더하므로,
+ * 주석 본문을 건너뛰는 동작처럼 토큰을 돌려주지 않는 동작의 시간도 포함된다.
+ * 정의하지 않으면 아래 매크로는 인자를 평가하지 않는 빈 식이 되어 스캐너에 아무 코드도
+ * 남지 않는다.
+ */
+#ifndef LEXPROF_H
+#define LEXPROF_H
+
+#define LEXPROF_MAX_RULES   64
+#define LEXPROF_MAX_STATES  4
+
+#ifdef COOL_LEX_PROFILE
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct lexprof {
+    uint64_t matches[LEXPROF_MAX_RULES];
+    uint64_t bytes[LEXPROF_MAX_RULES];
+    char sample[LEXPROF_MAX_RULES][16];     /* 규칙을 알아볼 수 있도록 처음 인식한 렉심 */
+    uint64_t ns[LEXPROF_MAX_STATES];
+    uint64_t mark;                          /* 마지막으로 시간을 잰 시각 */
+    struct lexprof *prev, *next;            /* 아직 닫지 않은 스캐너의 목록(lexprof.c) */
+} lexprof_t;
+
+/* 함수 프로토타입 선언 */
+uint64_t lexprof_now(void);
+void lexprof_sample(lexprof_t *p, int rule, const char *text, size_t len);
+void lexprof_open(lexprof_t *p, const char *const *states, int nstates);
+void lexprof_merge(lexprof_t *p);
+
+#define LEXPROF_ENTER(p)        ((p)->mark = lexprof_now())
+#define LEXPROF_MATCH(p, rule, state, text, len) do { \
+    uint64_t now_ = lexprof_now(); \
+    (p)->ns[state] += now_ - (p)->mark; \
+    (p)->mark = now_; \
+    if ((p)->matches[rule]++ == 0) \
+        lexprof_sample(p, rule, text, len); \
+    (p)->bytes[rule] += (len); \
+} while (0)
+#define LEXPROF_BYTES(p, rule, n)       ((p)->bytes[rule] += (n))
+#define LEXPROF_OPEN(p, states, n)      lexprof_open(p, states, n)
+#define LEXPROF_CLOSE(p)                lexprof_merge(p)
+#else
+#define LEXPROF_ENTER(p)                ((void)0)
+#define LEXPROF_MATCH(p, rule, state, text, len) ((void)0)
+#define LEXPROF_BYTES(p, rule, n)       ((void)0)
+#define LEXPROF_OPEN(p, states, n)      ((void)0)
+#define LEXPROF_CLOSE(p)                ((void)0)
+#endif
+
+#endif // LEXPROF_H
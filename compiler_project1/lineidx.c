@@ -0,0 +1,133 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#include "lineidx.h"
+#include <stdlib.h>
+#include <string.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/* base 오프셋이 line번째 줄인 빈 색인을 만든다 */
+void lineidx_init(lineidx_t *ix, size_t base, size_t line)
+{
+    memset(ix, 0, sizeof(*ix));
+    ix->base = ix->end = base;
+    ix->base_line = line;
+}
+
+static int push(lineidx_t *ix, size_t offset)
+{
+    if (ix->n == ix->cap) {
+        size_t cap = ix->cap ? ix->cap * 2 : 1024;
+        size_t *nl = realloc(ix->nl, sizeof(size_t) * cap);
+        if (!nl)
+            return -1;
+        ix->nl = nl;
+        ix->cap = cap;
+    }
+    ix->nl[ix->n++] = offset;
+    return 0;
+}
+
+/*
+ * 색인한 구간 바로 뒤의 len 바이트 p[0..len)를 훑어 줄바꿈을 색인에 더한다.
+ * 메모리가 모자라면 -1을 돌려준다.
+ */
+int lineidx_add(lineidx_t *ix, const char *p, size_t len)
+{
+    size_t off = ix->end, i = 0;
+
+#if defined(__AVX2__)
+    const __m256i nl = _mm256_set1_epi8('\n');
+
+    for (; len - i >= 32; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(p + i));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, nl));
+        for (; mask; mask &= mask - 1)
+            if (push(ix, off + i + __builtin_ctz(mask)) < 0)
+                return -1;
+    }
+#elif defined(__SSE2__)
+    const __m128i nl = _mm_set1_epi8('\n');
+
+    for (; len - i >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, nl));
+        for (; mask; mask &= mask - 1)
+            if (push(ix, off + i + __builtin_ctz(mask)) < 0)
+                return -1;
+    }
+#endif
+    for (; i < len; i++)
+        if (p[i] == '\n' && push(ix, off + i) < 0)
+            return -1;
+    ix->end = off + len;
+    return 0;
+}
+
+/* offset 앞에 있는 줄바꿈의 수. 직전 조회 위치 근처부터 찾는다 */
+static size_t count_before(lineidx_t *ix, size_t offset)
+{
+    size_t lo = 0, hi = ix->n, mid, k = ix->hint;
+
+    if (k > ix->n || (k > 0 && ix->nl[k - 1] >= offset))
+        k = 0;
+    else {
+        /* 토큰 순서대로 조회하면 대개 몇 칸 안에서 끝난다 */
+        for (mid = 0; mid < 8 && k < ix->n && ix->nl[k] < offset; mid++)
+            k++;
+        if (k == ix->n || ix->nl[k] >= offset)
+            return ix->hint = k;
+        lo = k;
+    }
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (ix->nl[mid] < offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return ix->hint = lo;
+}
+
+/* 색인한 구간 안의 offset이 있는 줄번호 */
+size_t lineidx_line(lineidx_t *ix, size_t offset)
+{
+    return ix->base_line + count_before(ix, offset);
+}
+
+/* 색인한 구간 안의 offset이 그 줄에서 몇 번째 바이트인지(1부터) */
+size_t lineidx_column(lineidx_t *ix, size_t offset)
+{
+    size_t k = count_before(ix, offset);
+
+    return offset - (k ? ix->nl[k - 1] + 1 : ix->base) + 1;
+}
+
+/*
+ * offset 앞의 줄바꿈을 색인에서 버린다. offset이 있는 줄의 시작이 새 base가 되며,
+ * 이후에는 그 뒤의 오프셋만 조회할 수 있다.
+ */
+void lineidx_trim(lineidx_t *ix, size_t offset)
+{
+    size_t k = count_before(ix, offset);
+
+    if (k == 0)
+        return;
+    ix->base_line += k;
+    ix->base = ix->nl[k - 1] + 1;
+    ix->n -= k;
+    memmove(ix->nl, ix->nl + k, sizeof(size_t) * ix->n);
+    ix->hint = 0;
+}
+
+void lineidx_free(lineidx_t *ix)
+{
+    free(ix->nl);
+    ix->nl = NULL;
+    ix->n = ix->cap = 0;
+}
@@ -0,0 +1,320 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * cool_lexer의 main.
+ *
+ *   사용법: cool_lexer [--emit=tokens|tokens-bin] [--jobs=N] [--split[=BYTES]]
+ *                     [--keep-going] [file.cl | @filelist] ...
+ *
+ * 파일이 여러 개이면 고정 크기 스레드 풀에서 나누어 스캔하고, 각 파일의 덤프를
+ * 파일별 메모리 버퍼에 모았다가 명령행 순서대로 한 번씩 내보낸다.
+ * @filelist는 한 줄에 하나씩 파일 경로가 적힌 목록 파일이다.
+ * --split은 파일 하나를 BYTES 크기의 청크로 나누어 병렬로 스캔한다(parlex.h).
+ * --keep-going은 어휘 오류에서 끝내지 않고 ERROR 토큰을 출력한 뒤 계속하며,
+ * 파일별로 모은 진단을 모든 덤프가 끝난 뒤 "파일:줄: 문구" 형식으로 표준오류에 출력한다.
+ * --keep-going이 없으면 파일 하나씩 순서대로 스캔할 때와 같이 오류가 난 파일의
+ * 덤프와 메시지까지 출력하고 1로 끝난다. 잘못된 UTF-8 경고는 각 파일의 덤프 뒤에
+ * "파일:줄: Warning: 문구" 형식으로 출력한다.
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "cool_lexer.h"
+#include "outbuf.h"
+#include "parlex.h"
+
+/* 파일 하나를 스캔하는 작업 */
+typedef struct job {
+    const char *path;
+    outbuf_t out;
+    cool_diag_t *diags;     /* --keep-going에서 모은 진단이나 미뤄 둔 경고 */
+    size_t ndiags;
+    char errmsg[64];        /* --keep-going이 없을 때 스캔을 멈춘 오류의 메시지 */
+    int err;                /* 출력 버퍼를 준비하지 못했을 때의 errno */
+    int failed;             /* 파일을 열 수 없었다 */
+    int done;
+} job_t;
+
+static job_t *jobs;
+static int njobs;
+static int next_job;
+static int emitBin = 0;
+static int split = 0;
+static int keepGoing = 0;
+static size_t splitSize = 0;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+
+/*
+ * 토큰 덤프는 표준출력 버퍼에 모았다가 한꺼번에 내보낸다.
+ * 오류로 exit()하는 경우에도 그때까지의 토큰이 출력되도록 atexit()에 등록한다.
+ * 출력에 실패한 적이 있으면 알리고 1로 끝낸다. atexit() 안에서는 exit()를 다시
+ * 부를 수 없으므로 _exit()를 쓴다.
+ */
+static outbuf_t out;
+
+static void flush_out(void)
+{
+    if (outbuf_flush(&out) < 0) {
+        perror("cool_lexer");
+        fflush(NULL);
+        _exit(1);
+    }
+}
+
+/* 스캐너 하나로 입력 끝까지 덤프한다 */
+static void dump(cool_lexer_t *lx, outbuf_t *ob)
+{
+    lx->recover = keepGoing;
+    if (emitBin)
+        cool_lexer_dump_bin(lx, ob);
+    else
+        cool_lexer_dump(lx, ob);
+}
+
+/* 파일 하나에서 모은 진단을 출력하고 메모리를 해제한다. 진단이 있었으면 1을 돌려준다 */
+static int report(const char *path, cool_diag_t *diags, size_t ndiags)
+{
+    size_t i;
+
+    for (i = 0; i < ndiags; i++)
+        fprintf(stderr, "%s:%zu: %s\n", path, diags[i].line, diags[i].msg);
+    free(diags);
+    return ndiags > 0;
+}
+
+/* 작업 목록에 파일을 추가한다 */
+static void add_job(const char *path)
+{
+    static int cap = 0;
+
+    if (njobs == cap) {
+        cap = cap ? cap * 2 : 16;
+        if (!(jobs = realloc(jobs, sizeof(job_t) * cap))) {
+            perror("cool_lexer");
+            exit(1);
+        }
+    }
+    memset(&jobs[njobs], 0, sizeof(job_t));
+    jobs[njobs++].path = path;
+}
+
+/* @filelist의 각 줄을 작업으로 추가한다 */
+static void add_list(const char *list)
+{
+    FILE *fp;
+    char line[4096];
+    size_t n;
+
+    if (!(fp = fopen(list, "r"))) {
+        printf("\"%s\"는 잘못된 파일 경로입니다.\n", list);
+        exit(1);
+    }
+    while (fgets(line, sizeof(line), fp)) {
+        n = strcspn(line, "\r\n");
+        line[n] = '\0';
+        if (n > 0)
+            add_job(strdup(line));
+    }
+    fclose(fp);
+}
+
+/*
+ * 작업을 하나씩 가져와 파일별 버퍼에 덤프한다. 작업 스레드에서 exit()하지 않도록
+ * 스캐너가 끝냈어야 할 오류는 메시지만 남기고 멈추게 하며(deferred), run_jobs()가
+ * 그 파일의 차례에 출력한다.
+ */
+static void *worker(void *arg)
+{
+    int i;
+    cool_lexer_t *lx;
+
+    (void)arg;
+    while ((i = __atomic_fetch_add(&next_job, 1, __ATOMIC_RELAXED)) < njobs) {
+        job_t *job = &jobs[i];
+        if (outbuf_init(&job->out, -1) < 0)
+            job->err = errno;
+        else if (!(lx = cool_lexer_open_file(job->path)))
+            job->failed = 1;
+        else {
+            lx->deferred = 1;
+            dump(lx, &job->out);
+            memcpy(job->errmsg, lx->errmsg, sizeof(job->errmsg));
+            job->diags = lx->diags;
+            job->ndiags = lx->ndiags;
+            lx->diags = NULL;
+            cool_lexer_close(lx);
+        }
+        pthread_mutex_lock(&lock);
+        job->done = 1;
+        pthread_cond_broadcast(&done_cond);
+        pthread_mutex_unlock(&lock);
+    }
+    return NULL;
+}
+
+/*
+ * 여러 파일을 스레드 풀에서 스캔하고 끝나는 대로 명령행 순서에 맞추어 출력한다.
+ * 열 수 없거나 진단이 나온 파일이 있으면 1을 돌려준다. 스캔이 오류로 멈춘 파일이
+ * 있으면 그 파일의 덤프와 메시지까지 출력하고, 뒤의 파일은 덤프도 진단도 출력하지 않고
+ * 1을 돌려준다. 메모리가 없거나 표준출력에 쓸 수 없으면 알리고 그 자리에서 멈춘다.
+ */
+static int run_jobs(int nthreads)
+{
+    pthread_t *threads;
+    int i, n, status = 0;
+
+    if (nthreads > njobs)
+        nthreads = njobs;
+    if (!(threads = malloc(sizeof(pthread_t) * nthreads))) {
+        perror("cool_lexer");
+        exit(1);
+    }
+    for (i = 0; i < nthreads; i++)
+        if (pthread_create(&threads[i], NULL, worker, NULL) != 0) {
+            perror("cool_lexer");
+            exit(1);
+        }
+    /* n은 출력한 파일의 수이다. 멈춘 파일까지 세며, 진단도 그 파일까지만 출력한다 */
+    for (n = 0; n < njobs; ) {
+        job_t *job = &jobs[n++];
+        pthread_mutex_lock(&lock);
+        while (!job->done)
+            pthread_cond_wait(&done_cond, &lock);
+        pthread_mutex_unlock(&lock);
+        if (job->err) {
+            errno = job->err;
+            perror("cool_lexer");
+            status = 1;
+            break;
+        }
+        if (job->failed) {
+            printf("\"%s\"는 잘못된 파일 경로입니다.\n", job->path);
+            fflush(stdout);
+            status = 1;
+        } else if (outbuf_drain(&job->out, STDOUT_FILENO) < 0) {
+            perror("cool_lexer");
+            status = 1;
+            break;
+        }
+        outbuf_free(&job->out);
+        if (!keepGoing) {       /* 경고는 종료 상태를 바꾸지 않는다 */
+            report(job->path, job->diags, job->ndiags);
+            job->diags = NULL;
+            job->ndiags = 0;
+        }
+        if (job->errmsg[0]) {
+            fputs(job->errmsg, stderr);
+            status = 1;
+            break;
+        }
+    }
+    __atomic_store_n(&next_job, njobs, __ATOMIC_RELAXED);
+    for (i = 0; i < nthreads; i++)
+        pthread_join(threads[i], NULL);
+    free(threads);
+    for (i = 0; i < njobs; i++) {
+        outbuf_free(&jobs[i].out);
+        if (i < n)
+            status |= report(jobs[i].path, jobs[i].diags, jobs[i].ndiags);
+        else
+            free(jobs[i].diags);
+    }
+    return status;
+}
+
+int main(int argc, char *argv[])
+{
+    int argi, status;
+    int nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    cool_lexer_t *lx;
+
+    /*
+     * --emit=tokens(기본값)는 텍스트 덤프를, --emit=tokens-bin은 이진 토큰 스트림을 출력한다.
+     * --jobs=N은 여러 파일을 스캔할 스레드 수이며 기본값은 CPU 수이다.
+     * --split[=BYTES]는 파일 하나를 청크로 나누어 스캔하며, BYTES가 없으면 크기를 자동으로 정한다.
+     * --keep-going은 어휘 오류를 만나도 끝내지 않는다. 청크 스캔은 오류에서 멈추므로
+     * --split과 함께 쓸 수 없다.
+     */
+    for (argi = 1; argi < argc && strncmp(argv[argi], "--", 2) == 0; argi++) {
+        if (strcmp(argv[argi], "--emit=tokens-bin") == 0)
+            emitBin = 1;
+        else if (strcmp(argv[argi], "--emit=tokens") == 0)
+            emitBin = 0;
+        else if (strncmp(argv[argi], "--jobs=", 7) == 0 && atoi(argv[argi] + 7) > 0)
+            nthreads = atoi(argv[argi] + 7);
+        else if (strcmp(argv[argi], "--split") == 0)
+            split = 1;
+        else if (strncmp(argv[argi], "--split=", 8) == 0 && atol(argv[argi] + 8) > 0) {
+            split = 1;
+            splitSize = (size_t)atol(argv[argi] + 8);
+        }
+        else if (strcmp(argv[argi], "--keep-going") == 0)
+            keepGoing = 1;
+        else {
+            fprintf(stderr, "알 수 없는 옵션입니다: %s\n", argv[argi]);
+            exit(1);
+        }
+    }
+    if (nthreads < 1)
+        nthreads = 1;
+    if (split && keepGoing) {
+        fprintf(stderr, "--keep-going은 --split과 함께 쓸 수 없습니다\n");
+        exit(1);
+    }
+    if (argi < argc) {
+        for (; argi < argc; argi++) {
+            if (argv[argi][0] == '@')
+                add_list(argv[argi] + 1);
+            else
+                add_job(argv[argi]);
+        }
+        if (njobs == 0)
+            return 0;
+    }
+    if (njobs > 1)
+        return run_jobs(nthreads);
+
+    if (outbuf_init(&out, STDOUT_FILENO) < 0) {
+        perror("cool_lexer");
+        exit(1);
+    }
+    atexit(flush_out);
+    if (split && njobs == 1) {
+        if (parlex_dump(jobs[0].path, splitSize, nthreads, emitBin, &out) < 0) {
+            printf("\"%s\"는 잘못된 파일 경로입니다.\n", jobs[0].path);
+            exit(1);
+        }
+        return 0;
+    }
+
+    /*
+     * 스캔할 COOL 파일을 연다. 파일명이 없으면 표준입력이 사용된다.
+     */
+    if (njobs == 1) {
+        if (!(lx = cool_lexer_open_file(jobs[0].path))) {
+            printf("\"%s\"는 잘못된 파일 경로입니다.\n", jobs[0].path);
+            exit(1);
+        }
+    } else if (!(lx = cool_lexer_open_stream(stdin))) {
+        perror("cool_lexer");
+        exit(1);
+    }
+    /*
+     * 토큰을 식별할 때마다 줄번호, 타입, 문자열(lexeme)을 출력한다
+     */
+    dump(lx, &out);
+    outbuf_flush(&out);
+    status = report(njobs == 1 ? jobs[0].path : "<stdin>", lx->diags, lx->ndiags);
+    lx->diags = NULL;
+    cool_lexer_close(lx);
+    return status;
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#include "outbuf.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* 줄번호를 printf("%03zu")와 같은 모양으로 변환한다. 변환된 길이를 돌려준다 */
+static size_t format_line(char *dst, size_t line)
+{
+    char tmp[24];
+    size_t v = line;
+    size_t n = 0, i;
+
+    do {
+        tmp[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    while (n < 3)
+        tmp[n++] = '0';
+    for (i = 0; i < n; i++)
+        dst[i] = tmp[n - 1 - i];
+    return n;
+}
+
+/* 버퍼를 준비한다. 메모리를 할당할 수 없으면 -1을 돌려준다 */
+int outbuf_init(outbuf_t *ob, int fd)
+{
+    ob->fd = fd;
+    ob->err = 0;
+    ob->len = 0;
+    ob->cap = OUTBUF_SIZE;
+    ob->buf = malloc(OUTBUF_SIZE);
+    return ob->buf ? 0 : -1;
+}
+
+void outbuf_free(outbuf_t *ob)
+{
+    free(ob->buf);
+    ob->buf = NULL;
+    ob->len = ob->cap = 0;
+}
+
+/*
+ * 버퍼에 쌓인 내용을 write(2)로 한꺼번에 fd에 내보내고 버퍼를 비운다.
+ * 한 번이라도 내보내기에 실패했으면 errno를 그 오류로 두고 -1을 돌려준다.
+ */
+int outbuf_drain(outbuf_t *ob, int fd)
+{
+    const char *p = ob->buf;
+    size_t left = ob->err ? 0 : ob->len;
+    ssize_t n;
+
+    while (left > 0) {
+        n = write(fd, p, left);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            ob->err = errno;
+            break;
+        }
+        p += n;
+        left -= (size_t)n;
+    }
+    ob->len = 0;
+    if (ob->err) {
+        errno = ob->err;
+        return -1;
+    }
+    return 0;
+}
+
+int outbuf_flush(outbuf_t *ob)
+{
+    return ob->fd >= 0 ? outbuf_drain(ob, ob->fd) : 0;
+}
+
+/*
+ * 버퍼에 최소 need 바이트의 자리를 만든다.
+ * 출력 모드에서는 내보내고, 메모리 모드에서는 버퍼를 두 배씩 늘린다.
+ */
+static void make_room(outbuf_t *ob, size_t need)
+{
+    size_t cap;
+    char *tmp;
+
+    if (ob->cap - ob->len >= need)
+        return;
+    if (ob->fd >= 0) {
+        outbuf_drain(ob, ob->fd);
+        return;
+    }
+    for (cap = ob->cap * 2; cap - ob->len < need; cap *= 2)
+        ;
+    if (!(tmp = realloc(ob->buf, cap)))
+        abort();
+    ob->buf = tmp;
+    ob->cap = cap;
+}
+
+void outbuf_write(outbuf_t *ob, const char *s, size_t len)
+{
+    size_t n;
+
+    while (len > 0) {
+        if (ob->len == ob->cap)
+            make_room(ob, len);
+        n = ob->cap - ob->len;
+        if (n > len)
+            n = len;
+        memcpy(ob->buf + ob->len, s, n);
+        ob->len += n;
+        s += n;
+        len -= n;
+    }
+}
+
+/*
+ * "%03zu:[%s] %s\n" 형식의 토큰 한 줄을 버퍼에 추가한다.
+ * 줄번호와 토큰 이름은 printf 없이 버퍼에 바로 채우고, 렉심은 길이만큼 복사한다.
+ * 토큰 이름은 짧으므로 한 번 비우고 나면 항상 자리가 남는다.
+ */
+void outbuf_token(outbuf_t *ob, size_t line, const char *name, size_t name_len,
+                  const char *text, size_t len)
+{
+    char *p;
+
+    make_room(ob, name_len + 26);
+    p = ob->buf + ob->len;
+    p += format_line(p, line);
+    *p++ = ':';
+    *p++ = '[';
+    memcpy(p, name, name_len);
+    p += name_len;
+    *p++ = ']';
+    *p++ = ' ';
+    ob->len = (size_t)(p - ob->buf);
+    outbuf_write(ob, text, len);
+    outbuf_write(ob, "\n", 1);
+}
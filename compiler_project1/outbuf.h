@@ -0,0 +1,37 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#ifndef OUTBUF_H
+#define OUTBUF_H
+
+#include <stddef.h>
+
+/* 한 번의 write(2)로 내보낼 출력 블록의 크기 */
+#define OUTBUF_SIZE (64 * 1024)
+
+/*
+ * 토큰 덤프 출력 버퍼.
+ * fd가 0 이상이면 버퍼가 찰 때마다 fd로 내보내고, -1이면 메모리에 계속 쌓아 둔다.
+ * 내보내기에 실패하면 그 errno를 err에 남기고 이후의 출력은 버린다.
+ */
+typedef struct outbuf {
+    int fd;
+    int err;
+    size_t len;
+    size_t cap;
+    char *buf;
+} outbuf_t;
+
+/* 함수 프로토타입 선언 */
+int outbuf_init(outbuf_t *ob, int fd);
+void outbuf_free(outbuf_t *ob);
+void outbuf_write(outbuf_t *ob, const char *s, size_t len);
+void outbuf_token(outbuf_t *ob, size_t line, const char *name, size_t name_len,
+                  const char *text, size_t len);
+int outbuf_flush(outbuf_t *ob);
+int outbuf_drain(outbuf_t *ob, int fd);
+
+#endif // OUTBUF_H
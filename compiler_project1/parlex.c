@@ -0,0 +1,287 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#include "parlex.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "cool_lexer.h"
+#include "cltok.h"
+
+/* 청크 하나를 한 가지 시작 상태로 추측 스캔한 결과 */
+typedef struct run {
+    size_t start;
+    size_t limit;
+    int state;              /* 시작 상태. -1이면 스캔하지 않는다 */
+    cltok_token_t *toks;    /* line은 청크 시작으로부터의 줄 증가분이다 */
+    size_t ntoks;
+    size_t cap;
+    size_t lines;           /* 청크 안에서 센 줄바꿈 수 */
+    size_t stop;            /* 스캔을 멈춘 오프셋 */
+    int end_state;
+    int end_depth;
+    int failed;
+} run_t;
+
+/* 추측 스캔 작업 목록. runs[2*i]와 runs[2*i+1]이 i번째 청크의 INITIAL, COMMENT 결과이다 */
+typedef struct parlex {
+    int fd;
+    run_t *runs;
+    int nruns;
+    int next;
+} parlex_t;
+
+/* 출력 형식(텍스트 덤프 또는 .cltok)에 맞추어 토큰을 내보낸다 */
+typedef struct emitter {
+    outbuf_t *out;
+    const char *src;
+    int bin;
+    cltok_writer_t w;
+    size_t nameLen[64];
+} emitter_t;
+
+static void emit(emitter_t *e, int kind, size_t line, size_t offset, size_t len)
+{
+    const char *name;
+    int k = kind - CLTOK_KIND_BASE;
+
+    if (e->bin) {
+        cltok_write_token(&e->w, kind, line, offset, len);
+        return;
+    }
+    name = cool_token_name(kind);
+    if (!e->nameLen[k])
+        e->nameLen[k] = strlen(name);
+    outbuf_token(e->out, line, name, e->nameLen[k], e->src + offset, len);
+}
+
+/* 청크 하나를 추측 스캔한다. 오류를 만나거나 메모리가 모자라면 failed를 세운다 */
+static void speculate(int fd, run_t *r)
+{
+    cool_lexer_t *lx;
+    cool_token_t tok;
+    cltok_token_t *p;
+
+    lx = cool_lexer_open_range(fd, r->start, r->limit, 0, r->state,
+                               r->state == COOL_LEX_COMMENT ? 1 : 0);
+    if (!lx) {
+        r->failed = 1;
+        return;
+    }
+    lx->speculative = 1;
+    while (cool_lexer_next(lx, &tok) != 0) {
+        if (r->ntoks == r->cap) {
+            r->cap = r->cap ? r->cap * 2 : 1024;
+            if (!(p = realloc(r->toks, sizeof(cltok_token_t) * r->cap))) {
+                r->failed = 1;
+                break;
+            }
+            r->toks = p;
+        }
+        p = &r->toks[r->ntoks++];
+        p->kind = tok.kind;
+        p->line = tok.line;
+        p->offset = tok.offset;
+        p->len = tok.len;
+    }
+    r->failed |= lx->failed;
+    r->lines = cool_lexer_line(lx, lx->nextOffset);
+    r->stop = lx->nextOffset;
+    r->end_state = cool_lexer_state(lx);
+    r->end_depth = lx->comment_depth;
+    cool_lexer_close(lx);
+}
+
+static void *worker(void *arg)
+{
+    parlex_t *px = arg;
+    int i;
+
+    while ((i = __atomic_fetch_add(&px->next, 1, __ATOMIC_RELAXED)) < px->nruns)
+        if (px->runs[i].state >= 0)
+            speculate(px->fd, &px->runs[i]);
+    return NULL;
+}
+
+/* 스캔할 수 없는 입력(파이프, 빈 파일 등)은 처음부터 순서대로 스캔한다 */
+static int dump_stream(int fd, int bin, outbuf_t *out)
+{
+    FILE *fp;
+    cool_lexer_t *lx;
+
+    if (!(fp = fdopen(fd, "r"))) {
+        close(fd);
+        return -1;
+    }
+    if (!(lx = cool_lexer_open_stream(fp))) {
+        fclose(fp);
+        return -1;
+    }
+    if (bin)
+        cool_lexer_dump_bin(lx, out);
+    else
+        cool_lexer_dump(lx, out);
+    cool_lexer_close(lx);
+    fclose(fp);
+    return 0;
+}
+
+/*
+ * 파일 path를 chunk 바이트 단위(0이면 자동)로 나누어 nthreads개의 스레드로 스캔하고,
+ * 순차 스캔과 같은 토큰 덤프를 out에 출력한다. 파일을 열 수 없으면 -1을 돌려준다.
+ */
+int parlex_dump(const char *path, size_t chunk, int nthreads, int bin, outbuf_t *out)
+{
+    struct stat st;
+    parlex_t px;
+    emitter_t e;
+    pthread_t *threads;
+    size_t size, *bounds, b, t, pos;
+    const char *src, *nl;
+    int nchunks, i, n, state, depth;
+    size_t line;
+    cool_lexer_t *lx;
+    cool_token_t tok;
+
+    if ((px.fd = open(path, O_RDONLY)) < 0)
+        return -1;
+    if (fstat(px.fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size == 0)
+        return dump_stream(px.fd, bin, out);
+    size = (size_t)st.st_size;
+    if ((src = mmap(NULL, size, PROT_READ, MAP_PRIVATE, px.fd, 0)) == MAP_FAILED)
+        return dump_stream(px.fd, bin, out);
+    if (nthreads < 1)
+        nthreads = 1;
+    if (chunk == 0) {
+        chunk = size / ((size_t)nthreads * 4);
+        if (chunk < PARLEX_MIN_CHUNK)
+            chunk = PARLEX_MIN_CHUNK;
+    }
+    if (chunk > PARLEX_MAX_CHUNK)
+        chunk = PARLEX_MAX_CHUNK;
+
+    /*
+     * 청크 경계를 chunk 바이트마다 그 뒤의 첫 줄바꿈 바로 다음으로 잡는다.
+     */
+    if (!(bounds = malloc(sizeof(size_t) * (size / chunk + 2)))) {
+        perror("cool_lexer");
+        exit(1);
+    }
+    nchunks = 0;
+    b = 0;
+    while (b < size) {
+        bounds[nchunks++] = b;
+        t = b + chunk;
+        if (t >= size || !(nl = memchr(src + t - 1, '\n', size - t + 1)))
+            break;
+        b = (size_t)(nl - src) + 1;
+    }
+    bounds[nchunks] = size;
+
+    /*
+     * 줄바꿈이 없는 긴 구간 때문에 한 flex 버퍼에 담을 수 없는 청크가 생기면
+     * (cool_lexer_open_range()) 나누지 않고 처음부터 순서대로 스캔한다.
+     */
+    for (i = 0; i < nchunks; i++)
+        if (bounds[i + 1] - bounds[i] > COOL_LEX_MAX_RANGE - COOL_LEX_MAX_TOKEN - 1) {
+            free(bounds);
+            munmap((void *)src, size);
+            return dump_stream(px.fd, bin, out);
+        }
+
+    /*
+     * 모든 청크를 INITIAL과 COMMENT 두 상태로 추측 스캔한다.
+     * 첫 청크는 INITIAL에서 시작하는 것이 확실하므로 한 번만 스캔한다.
+     */
+    px.nruns = nchunks * 2;
+    px.next = 0;
+    if (!(px.runs = calloc(px.nruns, sizeof(run_t)))) {
+        perror("cool_lexer");
+        exit(1);
+    }
+    for (i = 0; i < px.nruns; i++) {
+        px.runs[i].start = bounds[i / 2];
+        px.runs[i].limit = bounds[i / 2 + 1];
+        px.runs[i].state = i % 2 ? COOL_LEX_COMMENT : COOL_LEX_INITIAL;
+    }
+    px.runs[1].state = -1;
+    n = nthreads < px.nruns ? nthreads : px.nruns;
+    if (!(threads = malloc(sizeof(pthread_t) * n))) {
+        perror("cool_lexer");
+        exit(1);
+    }
+    for (i = 0; i < n; i++)
+        if (pthread_create(&threads[i], NULL, worker, &px) != 0) {
+            perror("cool_lexer");
+            exit(1);
+        }
+    for (i = 0; i < n; i++)
+        pthread_join(threads[i], NULL);
+    free(threads);
+
+    /*
+     * 앞에서부터 실제 상태에 맞는 추측 결과를 골라 이어 붙인다.
+     * 앞 청크의 마지막 렉심이 경계를 넘었거나, 주석 깊이가 1이 아니거나,
+     * 추측 스캔이 실패했으면 그 청크를 실제 상태로 다시 스캔한다.
+     * 실제 오류는 이 재스캔에서 순차 스캔과 같은 위치에서 보고된다.
+     */
+    memset(&e, 0, sizeof(e));
+    e.out = out;
+    e.src = src;
+    e.bin = bin;
+    if (bin)
+        cltok_write_begin(&e.w, out);
+    state = COOL_LEX_INITIAL;
+    depth = 0;
+    line = 1;
+    pos = 0;
+    for (i = 0; i < nchunks; i++) {
+        run_t *r = NULL;
+        size_t k;
+
+        if (pos == bounds[i]) {
+            if (state == COOL_LEX_INITIAL)
+                r = &px.runs[2 * i];
+            else if (state == COOL_LEX_COMMENT && depth == 1)
+                r = &px.runs[2 * i + 1];
+        }
+        if (r && !r->failed) {
+            for (k = 0; k < r->ntoks; k++)
+                emit(&e, r->toks[k].kind, line + r->toks[k].line, r->toks[k].offset, r->toks[k].len);
+            line += r->lines;
+            state = r->end_state;
+            depth = r->end_depth;
+            pos = r->stop;
+            continue;
+        }
+        if (!(lx = cool_lexer_open_range(px.fd, pos, bounds[i + 1], line, state, depth))) {
+            perror("cool_lexer");
+            exit(1);
+        }
+        while (cool_lexer_next(lx, &tok) != 0)
+            emit(&e, tok.kind, tok.line, tok.offset, tok.len);
+        line = cool_lexer_line(lx, lx->nextOffset);
+        state = cool_lexer_state(lx);
+        depth = lx->comment_depth;
+        pos = lx->nextOffset;
+        cool_lexer_close(lx);
+    }
+    if (bin)
+        cltok_write_end(&e.w);
+
+    for (i = 0; i < px.nruns; i++)
+        free(px.runs[i].toks);
+    free(px.runs);
+    free(bounds);
+    munmap((void *)src, size);
+    close(px.fd);
+    return 0;
+}
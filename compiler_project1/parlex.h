@@ -0,0 +1,33 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 큰 파일 하나를 여러 청크로 나누어 병렬로 스캔한다.
+ *
+ * 청크 경계는 줄바꿈 바로 뒤에 둔다. 그러면 경계에서의 스캔 상태는 INITIAL이거나
+ * 주석 안(COMMENT)뿐이고, 한 줄 주석은 줄바꿈에서 끝나므로 경계를 넘지 않는다.
+ * 각 청크를 두 상태(INITIAL, 깊이 1의 COMMENT)로 동시에 추측 스캔한 뒤,
+ * 앞에서부터 실제 상태에 맞는 결과를 골라 줄번호를 더해 가며 이어 붙인다.
+ * 맞는 결과가 없으면(더 깊은 주석, 경계를 넘는 문자열, 오류) 그 청크만 실제 상태로
+ * 다시 스캔하므로 출력은 순차 스캔과 항상 같다.
+ */
+#ifndef PARLEX_H
+#define PARLEX_H
+
+#include <stddef.h>
+#include "outbuf.h"
+
+/* chunk가 0일 때 쓰는 최소 청크 크기 */
+#define PARLEX_MIN_CHUNK (256 * 1024)
+
+/* 청크 크기의 상한. 청크마다 flex 버퍼 하나로 스캔한다(COOL_LEX_MAX_RANGE) */
+#define PARLEX_MAX_CHUNK (1024 * 1024 * 1024)
+
+/* 함수 프로토타입 선언 */
+int parlex_dump(const char *path, size_t chunk, int nthreads, int bin, outbuf_t *out);
+
+#endif // PARLEX_H
@@ -0,0 +1,179 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#include "relex.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cool_lexer.h"
+
+static void *xrealloc(void *p, size_t size)
+{
+    if (!(p = realloc(p, size))) {
+        perror("cool_lexer");
+        exit(1);
+    }
+    return p;
+}
+
+/* 토큰 배열이 n개를 담을 수 있게 한다 */
+static void reserve_toks(cltok_token_t **toks, size_t *cap, size_t n)
+{
+    if (n <= *cap)
+        return;
+    while (*cap < n)
+        *cap = *cap ? *cap * 2 : 1024;
+    *toks = xrealloc(*toks, sizeof(cltok_token_t) * *cap);
+}
+
+/* 끝이 offset보다 앞인 토큰의 수 */
+static size_t count_before(const relex_doc_t *doc, size_t offset)
+{
+    size_t lo = 0, hi = doc->ntoks, mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (doc->toks[mid].offset + doc->toks[mid].len < offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* 시작이 offset보다 앞인 토큰의 수 */
+static size_t count_starting_before(const relex_doc_t *doc, size_t offset)
+{
+    size_t lo = 0, hi = doc->ntoks, mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (doc->toks[mid].offset < offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/*
+ * toks[keep] 자리부터 새 소스를 다시 스캔한다. 편집 뒤의 새 소스에서 sync_from 이후에
+ * 시작하는 토큰은 delta만큼 옮긴 옛 토큰 toks[j..ntoks)와 비교하여, 같으면 스캔을 멈추고
+ * 그 뒤의 옛 토큰을 옮겨 붙인다. 스캔 오류가 나면 -1을 돌려준다.
+ */
+static int rescan(relex_doc_t *doc, size_t keep, size_t j, size_t sync_from, long delta,
+                  relex_change_t *change)
+{
+    cool_lexer_t *lx;
+    cool_token_t tok;
+    cltok_token_t *fresh = NULL, *t;
+    size_t nfresh = 0, fcap = 0, start, n = doc->ntoks, k;
+    size_t line, line_delta = 0;
+    int sync = 0;
+
+    start = keep ? doc->toks[keep - 1].offset + doc->toks[keep - 1].len : 0;
+    line = keep ? doc->toks[keep - 1].line : 1;
+    if (!(lx = cool_lexer_open_mem(doc->text, doc->len, start, line))) {
+        perror("cool_lexer");
+        exit(1);
+    }
+    lx->speculative = 1;
+    while (cool_lexer_next(lx, &tok) != 0) {
+        if (tok.offset >= sync_from) {
+            size_t old = (size_t)((long)tok.offset - delta);
+            while (j < n && doc->toks[j].offset < old)
+                j++;
+            if (j < n && doc->toks[j].offset == old &&
+                doc->toks[j].kind == tok.kind && doc->toks[j].len == tok.len) {
+                sync = 1;
+                /* 줄이 줄었으면 부호 없는 뺄셈이 감싸 돌지만 더할 때 다시 감싸 돌아 맞는다 */
+                line_delta = tok.line - doc->toks[j].line;
+                break;
+            }
+        }
+        reserve_toks(&fresh, &fcap, nfresh + 1);
+        t = &fresh[nfresh++];
+        t->kind = tok.kind;
+        t->line = tok.line;
+        t->offset = tok.offset;
+        t->len = tok.len;
+    }
+    doc->failed = lx->failed;
+    cool_lexer_close(lx);
+
+    if (!sync)
+        j = n;
+    reserve_toks(&doc->toks, &doc->tcap, keep + nfresh + (n - j));
+    if (n > j)
+        memmove(&doc->toks[keep + nfresh], &doc->toks[j], sizeof(cltok_token_t) * (n - j));
+    if (nfresh)
+        memcpy(&doc->toks[keep], fresh, sizeof(cltok_token_t) * nfresh);
+    doc->ntoks = keep + nfresh + (n - j);
+    for (k = keep + nfresh; k < doc->ntoks; k++) {
+        doc->toks[k].offset += delta;
+        doc->toks[k].line += line_delta;
+    }
+    free(fresh);
+    if (change) {
+        change->first = keep;
+        change->removed = j - keep;
+        change->inserted = nfresh;
+    }
+    return doc->failed ? -1 : 0;
+}
+
+/* 소스 src를 복사하여 문서를 만들고 처음부터 스캔한다. 스캔 오류가 나면 -1을 돌려준다 */
+int relex_open(relex_doc_t *doc, const char *src, size_t len)
+{
+    memset(doc, 0, sizeof(*doc));
+    doc->cap = len + 2;
+    doc->text = xrealloc(NULL, doc->cap);
+    memcpy(doc->text, src, len);
+    doc->text[len] = doc->text[len + 1] = '\0';
+    doc->len = len;
+    return rescan(doc, 0, 0, 0, 0, NULL);
+}
+
+/*
+ * 소스의 offset부터 del 바이트를 지우고 그 자리에 ins[0..ins_len)을 넣은 뒤 토큰 배열을
+ * 고친다. 바뀐 토큰 범위를 change에 기록한다(NULL이면 기록하지 않는다).
+ * 편집 범위가 소스를 벗어나거나 스캔 오류가 나면 -1을 돌려준다.
+ * 오류가 난 문서도 다음 편집에서 다시 스캔되므로 계속 편집할 수 있다.
+ */
+int relex_edit(relex_doc_t *doc, size_t offset, size_t del, const char *ins, size_t ins_len,
+               relex_change_t *change)
+{
+    size_t keep, j, len;
+
+    if (offset > doc->len || del > doc->len - offset)
+        return -1;
+
+    /*
+     * 편집 위치보다 앞에서 끝나는 토큰은 그대로 둔다. 편집 위치에서 끝나는 토큰은
+     * 뒤에 붙는 문자(예: "<" 뒤의 "=")로 길어질 수 있으므로 다시 스캔한다.
+     * 오류로 멈춘 문서는 오류 뒤의 토큰이 없으므로 끝까지 다시 스캔한다.
+     */
+    keep = count_before(doc, offset);
+    j = doc->failed ? doc->ntoks : count_starting_before(doc, offset + del);
+
+    len = doc->len - del + ins_len;
+    if (len + 2 > doc->cap) {
+        doc->cap = len + 2 > doc->cap * 2 ? len + 2 : doc->cap * 2;
+        doc->text = xrealloc(doc->text, doc->cap);
+    }
+    memmove(doc->text + offset + ins_len, doc->text + offset + del, doc->len - offset - del);
+    memcpy(doc->text + offset, ins, ins_len);
+    doc->text[len] = doc->text[len + 1] = '\0';
+    doc->len = len;
+    return rescan(doc, keep, j, offset + ins_len, (long)ins_len - (long)del, change);
+}
+
+void relex_close(relex_doc_t *doc)
+{
+    free(doc->text);
+    free(doc->toks);
+    memset(doc, 0, sizeof(*doc));
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 편집기에서 쓰는 증분 스캔.
+ *
+ * 문서는 소스와 그 토큰 배열을 함께 가진다. 편집(offset, 지운 길이, 넣은 문자열)이
+ * 들어오면 편집 위치보다 앞에서 끝나는 마지막 토큰 뒤부터 다시 스캔한다.
+ * 토큰은 INITIAL 상태(주석 깊이 0)에서만 나오므로 토큰의 시작과 끝은 언제나 안전한
+ * 재시작 지점이다. 편집 구간 뒤에서 새 토큰이 옛 토큰과 (편집으로 밀린 만큼을
+ * 보정한) 같은 위치, 같은 종류, 같은 길이로 나오면 두 스캔의 상태와 남은 입력이
+ * 같으므로 나머지 옛 토큰을 오프셋과 줄번호만 옮겨 다시 쓴다.
+ * "(*"를 넣거나 "*)"를 지워 주석이 열리면 주석이 닫혀 토큰이 다시 맞을 때까지,
+ * 닫히지 않으면 입력 끝까지 스캔한다.
+ */
+#ifndef RELEX_H
+#define RELEX_H
+
+#include <stddef.h>
+#include "cltok.h"
+
+/* 소스와 토큰 배열 */
+typedef struct relex_doc {
+    char *text;             /* 끝에 '\0' 두 개를 붙여 둔다 */
+    size_t len;
+    size_t cap;
+    cltok_token_t *toks;
+    size_t ntoks;
+    size_t tcap;
+    int failed;             /* 마지막 스캔이 오류로 멈추었으면 1. toks는 오류 앞까지이다 */
+} relex_doc_t;
+
+/* 편집으로 바뀐 토큰 범위: toks[first]부터 removed개가 inserted개로 바뀌었다 */
+typedef struct relex_change {
+    size_t first;
+    size_t removed;
+    size_t inserted;
+} relex_change_t;
+
+/* 함수 프로토타입 선언 */
+int relex_open(relex_doc_t *doc, const char *src, size_t len);
+int relex_edit(relex_doc_t *doc, size_t offset, size_t del, const char *ins, size_t ins_len,
+               relex_change_t *change);
+void relex_close(relex_doc_t *doc);
+
+#endif // RELEX_H
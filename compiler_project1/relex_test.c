@@ -0,0 +1,101 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 증분 스캔(relex.h)을 검사한다. COOL 파일에 무작위 편집을 차례로 적용하면서
+ * 매번 증분 스캔 결과가 처음부터 다시 스캔한 결과와 같은지 비교한다.
+ * 스캔 오류가 나는 편집은 되돌리는 편집으로 다시 검사한다.
+ *
+ *   사용법: relex_test file.cl [편집 횟수] [seed]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "relex.h"
+#include "cltok.h"
+
+/* 편집에 넣는 조각. 주석을 열고 닫거나 토큰을 붙이고 가르는 것들이다 */
+static const char *pieces[] = {
+    "", " ", "\n", "x", "Foo", "42", "(*", "*)", "(* c *)", "--", "-- c\n",
+    "\"s\"", "\"", "<", "=", "-", "(", ")", "*", ";", "<-", "=>", "class", "#",
+};
+
+/* doc의 토큰이 소스를 처음부터 스캔한 결과와 같으면 1을 돌려준다 */
+static int same_as_full(const relex_doc_t *doc)
+{
+    relex_doc_t full;
+    size_t i;
+    int same;
+
+    relex_open(&full, doc->text, doc->len);
+    same = full.failed == doc->failed && full.ntoks == doc->ntoks;
+    for (i = 0; same && i < doc->ntoks; i++)
+        same = full.toks[i].kind == doc->toks[i].kind && full.toks[i].line == doc->toks[i].line &&
+               full.toks[i].offset == doc->toks[i].offset && full.toks[i].len == doc->toks[i].len;
+    relex_close(&full);
+    return same;
+}
+
+/* 편집 하나를 적용하고 검사한다. 오류가 났으면 되돌리는 편집도 검사한다 */
+static int check_edit(relex_doc_t *doc, size_t offset, size_t del, const char *ins, size_t *relexed)
+{
+    relex_change_t change;
+    size_t ins_len = strlen(ins);
+    char *removed = malloc(del + 1);
+
+    memcpy(removed, doc->text + offset, del);
+    relex_edit(doc, offset, del, ins, ins_len, &change);
+    *relexed += change.inserted;
+    if (!same_as_full(doc)) {
+        printf("편집 (%zu, %zu, \"%s\") 뒤의 토큰이 다릅니다.\n", offset, del, ins);
+        free(removed);
+        return 0;
+    }
+    if (doc->failed) {
+        relex_edit(doc, offset, ins_len, removed, del, &change);
+        *relexed += change.inserted;
+        if (!same_as_full(doc)) {
+            printf("편집 (%zu, %zu, \"%s\")을 되돌린 뒤의 토큰이 다릅니다.\n", offset, del, ins);
+            free(removed);
+            return 0;
+        }
+    }
+    free(removed);
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    relex_doc_t doc;
+    char *src;
+    size_t size, offset, del, relexed = 0;
+    int edits, i;
+
+    if (argc < 2) {
+        fprintf(stderr, "사용법: %s file.cl [편집 횟수] [seed]\n", argv[0]);
+        return 1;
+    }
+    edits = argc > 2 ? atoi(argv[2]) : 2000;
+    srand(argc > 3 ? (unsigned)atoi(argv[3]) : 1);
+    if (!(src = cltok_read_file(argv[1], &size))) {
+        printf("\"%s\"는 잘못된 파일 경로입니다.\n", argv[1]);
+        return 1;
+    }
+    relex_open(&doc, src, size);
+    for (i = 0; i < edits; i++) {
+        offset = (size_t)rand() % (doc.len + 1);
+        del = (size_t)rand() % 4 == 0 ? (size_t)rand() % (doc.len - offset + 1) % 16 : 0;
+        if (!check_edit(&doc, offset, del, pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))],
+                        &relexed))
+            return 1;
+    }
+    printf("편집 %d번, 토큰 %zu개, 편집마다 평균 %.1f개 재스캔\n",
+           edits, doc.ntoks, edits ? (double)relexed / edits : 0.0);
+    relex_close(&doc);
+    free(src);
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#include "skip.h"
+#include <stddef.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*
+ * p에서 시작하는 UTF-8 다중 바이트 문자 중 올바른 앞부분의 길이를 돌려주고, 완전한 문자의
+ * 길이(2~4)를 *need에 넣는다. 첫 바이트가 다중 바이트 문자를 시작할 수 없으면 0을 돌려주고
+ * *need도 0으로 둔다.
+ * 초과 길이 부호화, 서로게이트, U+10FFFF보다 큰 값은 잘못된 것으로 본다(cool.l의
+ * UTF8, BADUTF8 정의와 같다).
+ */
+static size_t utf8_prefix(const char *s, const char *end, size_t *need)
+{
+    const unsigned char *p = (const unsigned char *)s;
+    unsigned char lo = 0x80, hi = 0xbf;
+    size_t i;
+
+    if (p[0] >= 0xc2 && p[0] <= 0xdf)
+        *need = 2;
+    else if (p[0] >= 0xe0 && p[0] <= 0xef) {
+        *need = 3;
+        if (p[0] == 0xe0)
+            lo = 0xa0;
+        else if (p[0] == 0xed)
+            hi = 0x9f;
+    } else if (p[0] >= 0xf0 && p[0] <= 0xf4) {
+        *need = 4;
+        if (p[0] == 0xf0)
+            lo = 0x90;
+        else if (p[0] == 0xf4)
+            hi = 0x8f;
+    } else
+        return *need = 0;
+    for (i = 1; i < *need && s + i < end; i++) {
+        if (p[i] < lo || p[i] > hi)
+            break;
+        lo = 0x80;
+        hi = 0xbf;
+    }
+    return i;
+}
+
+/* p에서 시작하는 올바른 UTF-8 다중 바이트 문자의 길이를 돌려준다. 잘못되었거나 잘렸으면 0이다 */
+static size_t utf8_len(const char *s, const char *end)
+{
+    size_t need, n = utf8_prefix(s, end, &need);
+
+    return n == need ? n : 0;
+}
+
+/* [p, end)에서 a나 b이거나 0x80 이상인 첫 바이트의 위치를 돌려준다. 없으면 end이다 */
+static const char *find_stop(const char *p, const char *end, char a, char b)
+{
+#if defined(__AVX2__)
+    const __m256i va = _mm256_set1_epi8(a);
+    const __m256i vb = _mm256_set1_epi8(b);
+
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p);
+        __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_or_si256(m, v));
+        if (mask)
+            return p + __builtin_ctz(mask);
+        p += 32;
+    }
+#endif
+#if defined(__SSE2__)
+    {
+        const __m128i va = _mm_set1_epi8(a);
+        const __m128i vb = _mm_set1_epi8(b);
+
+        while (end - p >= 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)p);
+            __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb));
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(m, v));
+            if (mask)
+                return p + __builtin_ctz(mask);
+            p += 16;
+        }
+    }
+#endif
+    while (p < end && *p != a && *p != b && !(*p & 0x80))
+        p++;
+    return p;
+}
+
+/*
+ * ASCII 구간은 벡터 명령으로 건너뛰고, 0x80 이상인 바이트를 만나면 그 자리의 UTF-8
+ * 문자를 검사하여 올바르면 문자째 건너뛴다. a나 b, 또는 잘못되었거나 잘린 UTF-8에서 멈춘다.
+ */
+static const char *skip_until(const char *p, const char *end, char a, char b)
+{
+    size_t n;
+
+    for (;;) {
+        p = find_stop(p, end, a, b);
+        if (p == end || !(*p & 0x80) || !(n = utf8_len(p, end)))
+            return p;
+        p += n;
+    }
+}
+
+const char *skip_comment_text(const char *p, const char *end)
+{
+    return skip_until(p, end, '(', '*');
+}
+
+const char *skip_line_text(const char *p, const char *end)
+{
+    return skip_until(p, end, '\n', '\n');
+}
+
+const char *skip_utf8(const char *p, const char *end)
+{
+    /* 0x80 이상인 바이트도 find_stop이 멈추는 곳이므로 멈출 ASCII 문자가 따로 없다 */
+    return skip_until(p, end, (char)0x80, (char)0x80);
+}
+
+size_t utf8_bad_len(const char *p, const char *end)
+{
+    size_t need, n = utf8_prefix(p, end, &need);
+
+    return n ? n : 1;
+}
+
+const char *skip_space(const char *p, const char *end)
+{
+    /* 공백은 대개 짧은 들여쓰기이므로 한 바이트씩 본다 */
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n'))
+        p++;
+    return p;
+}
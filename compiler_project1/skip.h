@@ -0,0 +1,27 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#ifndef SKIP_H
+#define SKIP_H
+
+#include <stddef.h>
+
+/*
+ * 주석 본문을 빠르게 건너뛰기 위한 스캔 함수.
+ * [p, end) 구간에서 조건에 맞는 첫 바이트의 위치를 돌려주며, 없으면 end를 돌려준다.
+ * AVX2나 SSE2로 컴파일되면 벡터 명령으로 한 번에 32/16바이트씩 검사한다.
+ * skip_space를 뺀 함수는 UTF-8 문자를 검사하며 건너뛰고, 잘못되었거나 end에서 잘린
+ * UTF-8 문자의 첫 바이트에서도 멈춘다.
+ */
+const char *skip_comment_text(const char *p, const char *end);  /* '(', '*' */
+const char *skip_line_text(const char *p, const char *end);     /* '\n' */
+const char *skip_utf8(const char *p, const char *end);          /* 잘못된 UTF-8만 */
+const char *skip_space(const char *p, const char *end);         /* ' ', '\t', '\n'가 아닌 것 */
+
+/* skip_utf8이 멈춘 p에서 잘못된 UTF-8 조각의 길이(1 이상). cool.l의 BADUTF8과 같다 */
+size_t utf8_bad_len(const char *p, const char *end);
+
+#endif // SKIP_H
@@ -0,0 +1,153 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#include "arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <sys/mman.h>
+
+#define ARENA_ALIGN 16
+
+/* 청크끼리는 연결해 두었다가 arena_release()에서 한꺼번에 해제한다 */
+struct arena_chunk {
+    arena_chunk_t *next;
+    size_t mapped;          /* mmap으로 잡은 크기. malloc으로 잡았으면 0이다 */
+    _Alignas(ARENA_ALIGN) char data[];
+};
+
+/* 0으로 채운 정적 아레나도 arena_init()한 것과 같이 쓸 수 있다 */
+void arena_init(arena_t *a)
+{
+    a->chunks = NULL;
+    a->avail = NULL;
+    a->left = 0;
+    a->chunk_size = ARENA_CHUNK_SIZE;
+    a->huge = 0;
+}
+
+void arena_init_huge(arena_t *a)
+{
+    arena_init(a);
+    a->chunk_size = ARENA_HUGE_CHUNK_SIZE - sizeof(arena_chunk_t);
+    a->huge = 1;
+}
+
+/*
+ * 청크 헤더를 포함해 size 바이트를 큰 페이지 경계에 맞추어 mmap으로 잡는다. 경계를 맞추려고
+ * 한 페이지만큼 더 잡은 뒤 앞뒤 남는 부분을 돌려준다. 실패하면 NULL이다.
+ */
+static arena_chunk_t *map_chunk(size_t size)
+{
+    const size_t huge = ARENA_HUGE_CHUNK_SIZE;
+    size_t len = (size + huge - 1) & ~(huge - 1);
+    char *p = mmap(NULL, len + huge, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    size_t head;
+    arena_chunk_t *c;
+
+    if (p == MAP_FAILED)
+        return NULL;
+    head = (size_t)(-(uintptr_t)p & (huge - 1));
+    if (head)
+        munmap(p, head);
+    if (huge - head)
+        munmap(p + head + len, huge - head);
+    c = (arena_chunk_t *)(p + head);
+#ifdef MADV_HUGEPAGE
+    madvise(c, len, MADV_HUGEPAGE);
+#endif
+    c->mapped = len;
+    return c;
+}
+
+/*
+ * size 바이트 이상의 새 청크를 잡는다. 청크의 4분의 1보다 큰 요청은 전용 청크에 두고
+ * 지금 쓰고 있는 청크는 그대로 이어서 쓴다. 큰 페이지를 잡지 못하면 malloc으로 잡고,
+ * 메모리가 없으면 더 진행할 수 없으므로 끝낸다.
+ */
+static char *new_chunk(arena_t *a, size_t size)
+{
+    size_t chunk = a->chunk_size ? a->chunk_size : ARENA_CHUNK_SIZE;
+    int dedicated = size > chunk / 4;
+    size_t n = dedicated ? size : chunk;
+    arena_chunk_t *c = a->huge ? map_chunk(sizeof(arena_chunk_t) + n) : NULL;
+
+    if (!c && (c = malloc(sizeof(arena_chunk_t) + n)))
+        c->mapped = 0;
+    if (!c) {
+        perror("arena");
+        exit(1);
+    }
+    if (dedicated && a->chunks) {
+        c->next = a->chunks->next;
+        a->chunks->next = c;
+        return c->data;
+    }
+    c->next = a->chunks;
+    a->chunks = c;
+    a->avail = c->data + size;
+    a->left = n - size;
+    return c->data;
+}
+
+/* 정렬되지 않은 size 바이트. 문자열처럼 정렬이 필요 없는 데이터에 쓴다 */
+char *arena_bytes(arena_t *a, size_t size)
+{
+    char *p;
+
+    if (size > a->left)
+        return new_chunk(a, size);
+    p = a->avail;
+    a->avail += size;
+    a->left -= size;
+    return p;
+}
+
+/* ARENA_ALIGN 바이트로 정렬된 size 바이트 */
+void *arena_alloc(arena_t *a, size_t size)
+{
+    size_t pad = (size_t)(-(uintptr_t)a->avail & (ARENA_ALIGN - 1));
+
+    if (pad + size > a->left)
+        return new_chunk(a, size);
+    a->avail += pad;
+    a->left -= pad;
+    return arena_bytes(a, size);
+}
+
+/*
+ * from의 청크를 모두 a로 옮겨 a와 함께 해제되게 한다. 다른 스레드가 자기 아레나에 만든
+ * 트리를 이어 붙일 때 쓴다. a가 지금 쓰고 있는 청크는 그대로 이어서 쓰고 from은 비운다.
+ */
+void arena_merge(arena_t *a, arena_t *from)
+{
+    arena_chunk_t *c = from->chunks;
+
+    if (c) {
+        while (c->next)
+            c = c->next;
+        if (a->chunks) {
+            c->next = a->chunks->next;
+            a->chunks->next = from->chunks;
+        } else
+            a->chunks = from->chunks;
+    }
+    arena_init(from);
+}
+
+void arena_release(arena_t *a)
+{
+    arena_chunk_t *c, *next;
+
+    for (c = a->chunks; c; c = next) {
+        next = c->next;
+        if (c->mapped)
+            munmap(c, c->mapped);
+        else
+            free(c);
+    }
+    arena_init(a);
+}
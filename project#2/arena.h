@@ -0,0 +1,41 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 청크 단위로 메모리를 잡아 앞에서부터 잘라 주는 아레나.
+ * 하나씩 해제할 수는 없고 arena_release()로 한꺼번에 돌려준다.
+ * arena_init_huge()로 초기화하면 큰 페이지 크기의 청크를 그 경계에 맞추어 mmap으로 잡고
+ * 커널에 큰 페이지를 쓰도록 알려 준다. 노드가 많은 트리에서 TLB 실패를 줄인다.
+ */
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+/* 한 번에 잡는 청크의 크기. 큰 페이지를 쓰면 큰 페이지 하나의 크기이다 */
+#define ARENA_CHUNK_SIZE        (64 * 1024)
+#define ARENA_HUGE_CHUNK_SIZE   (2 * 1024 * 1024)
+
+typedef struct arena_chunk arena_chunk_t;
+
+typedef struct arena {
+    arena_chunk_t *chunks;
+    char *avail;            /* 현재 청크에서 아직 쓰지 않은 곳 */
+    size_t left;
+    size_t chunk_size;      /* 새로 잡는 청크의 크기 */
+    int huge;               /* 청크를 큰 페이지 경계에 맞추어 mmap으로 잡는가 */
+} arena_t;
+
+/* 함수 프로토타입 선언 */
+void arena_init(arena_t *a);
+void arena_init_huge(arena_t *a);
+void *arena_alloc(arena_t *a, size_t size);
+char *arena_bytes(arena_t *a, size_t size);
+void arena_merge(arena_t *a, arena_t *from);
+void arena_release(arena_t *a);
+
+#endif // ARENA_H
@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton implementation for Bison's Yacc-like parsers in C
+/* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -36,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -43,187 +45,221 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.3"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
-
-/* Using locations.  */
-#define YYLSP_NEEDED 0
-
-
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     CLASS = 258,
-     INHERITS = 259,
-     IF = 260,
-     THEN = 261,
-     ELSE = 262,
-     FI = 263,
-     LET = 264,
-     IN = 265,
-     WHILE = 266,
-     LOOP = 267,
-     POOL = 268,
-     CASE = 269,
-     OF = 270,
-     DARROW = 271,
-     ESAC = 272,
-     NEW = 273,
-     ISVOID = 274,
-     ASSIGN = 275,
-     NOT = 276,
-     LTE = 277,
-     STRING = 278,
-     TYPE = 279,
-     ID = 280,
-     INTEGER = 281,
-     BOOLEAN = 282,
-     TRUE = 283,
-     FALSE = 284
-   };
-#endif
-/* Tokens.  */
-#define CLASS 258
-#define INHERITS 259
-#define IF 260
-#define THEN 261
-#define ELSE 262
-#define FI 263
-#define LET 264
-#define IN 265
-#define WHILE 266
-#define LOOP 267
-#define POOL 268
-#define CASE 269
-#define OF 270
-#define DARROW 271
-#define ESAC 272
-#define NEW 273
-#define ISVOID 274
-#define ASSIGN 275
-#define NOT 276
-#define LTE 277
-#define STRING 278
-#define TYPE 279
-#define ID 280
-#define INTEGER 281
-#define BOOLEAN 282
-#define TRUE 283
-#define FALSE 284
-
-
-
-
-/* Copy the first part of user declarations.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 1
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
 #line 8 "cool.y"
 
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <limits.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
 #include "node.h"
+#include "cool_lexer.h"
+#include "tokq.h"
+#include "parparse.h"
 
-int yylex();
-extern FILE* yyin;
-extern int yylineno;
-extern char *yytext;
-static int num_errors = 0;
-static class_list_t *program;
-void yyerror(char const *s);
+#line 88 "cool.tab.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
-
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 23 "cool.y"
+#include "cool.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-    class_t *class;
-    class_list_t *class_list;
-    feature_list_t *feature_list;
-    feature_t *feature;
-    formal_list_t *formal_list;
-    formal_t *formal;
-    expr_t *expr;
-    expr_list_t *expr_list;
-    case_list_t *case_list;
-    char *s;
-    int i;
-    bool b;
-}
-/* Line 193 of yacc.c.  */
-#line 184 "cool.tab.c"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-# define YYSTYPE_IS_TRIVIAL 1
-#endif
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_CLASS = 3,                      /* CLASS  */
+  YYSYMBOL_INHERITS = 4,                   /* INHERITS  */
+  YYSYMBOL_IF = 5,                         /* IF  */
+  YYSYMBOL_THEN = 6,                       /* THEN  */
+  YYSYMBOL_ELSE = 7,                       /* ELSE  */
+  YYSYMBOL_FI = 8,                         /* FI  */
+  YYSYMBOL_LET = 9,                        /* LET  */
+  YYSYMBOL_IN = 10,                        /* IN  */
+  YYSYMBOL_WHILE = 11,                     /* WHILE  */
+  YYSYMBOL_LOOP = 12,                      /* LOOP  */
+  YYSYMBOL_POOL = 13,                      /* POOL  */
+  YYSYMBOL_CASE = 14,                      /* CASE  */
+  YYSYMBOL_OF = 15,                        /* OF  */
+  YYSYMBOL_DARROW = 16,                    /* DARROW  */
+  YYSYMBOL_ESAC = 17,                      /* ESAC  */
+  YYSYMBOL_NEW = 18,                       /* NEW  */
+  YYSYMBOL_ISVOID = 19,                    /* ISVOID  */
+  YYSYMBOL_ASSIGN = 20,                    /* ASSIGN  */
+  YYSYMBOL_NOT = 21,                       /* NOT  */
+  YYSYMBOL_LTE = 22,                       /* LTE  */
+  YYSYMBOL_STRING = 23,                    /* STRING  */
+  YYSYMBOL_TYPE = 24,                      /* TYPE  */
+  YYSYMBOL_ID = 25,                        /* ID  */
+  YYSYMBOL_INTEGER = 26,                   /* INTEGER  */
+  YYSYMBOL_BOOLEAN = 27,                   /* BOOLEAN  */
+  YYSYMBOL_TRUE = 28,                      /* TRUE  */
+  YYSYMBOL_FALSE = 29,                     /* FALSE  */
+  YYSYMBOL_30_ = 30,                       /* ';'  */
+  YYSYMBOL_31_ = 31,                       /* '{'  */
+  YYSYMBOL_32_ = 32,                       /* '}'  */
+  YYSYMBOL_33_ = 33,                       /* '('  */
+  YYSYMBOL_34_ = 34,                       /* ')'  */
+  YYSYMBOL_35_ = 35,                       /* ':'  */
+  YYSYMBOL_36_ = 36,                       /* ','  */
+  YYSYMBOL_YYACCEPT = 37,                  /* $accept  */
+  YYSYMBOL_program = 38,                   /* program  */
+  YYSYMBOL_class_list = 39,                /* class_list  */
+  YYSYMBOL_class = 40,                     /* class  */
+  YYSYMBOL_feature_list = 41,              /* feature_list  */
+  YYSYMBOL_feature = 42,                   /* feature  */
+  YYSYMBOL_formal_list = 43,               /* formal_list  */
+  YYSYMBOL_formal = 44,                    /* formal  */
+  YYSYMBOL_expr = 45,                      /* expr  */
+  YYSYMBOL_expr_list = 46,                 /* expr_list  */
+  YYSYMBOL_case_list = 47                  /* case_list  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
 
 
-/* Copy the second part of user declarations.  */
+/* Unqualified %code blocks.  */
+#line 37 "cool.y"
 
+static int yylex(YYSTYPE *lval, cool_parse_t *ctx);
+static void yyerror(cool_parse_t *ctx, char const *s);
+static void report(cool_parse_t *ctx, char const *s, int lookahead);
+static class_t *class_done(cool_parse_t *ctx, class_t *cls);
 
-/* Line 216 of yacc.c.  */
-#line 197 "cool.tab.c"
+#line 177 "cool.tab.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -231,85 +267,112 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int i)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (i)
-    int i;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return i;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
 
-/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
-# ifdef YYSTACK_USE_ALLOCA
-#  if YYSTACK_USE_ALLOCA
-#   ifdef __GNUC__
-#    define YYSTACK_ALLOC __builtin_alloca
-#   elif defined __BUILTIN_VA_ARG_INCR
-#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
-#   elif defined _AIX
-#    define YYSTACK_ALLOC __alloca
-#   elif defined _MSC_VER
-#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
-#    define alloca _alloca
-#   else
-#    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef _STDLIB_H
-#      define _STDLIB_H 1
-#     endif
-#    endif
-#   endif
-#  endif
-# endif
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -323,88 +386,89 @@ YYID (i)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
 #   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
 #  endif
-#  if (defined __cplusplus && ! defined _STDLIB_H \
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef _STDLIB_H
-#    define _STDLIB_H 1
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
 #   endif
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss;
-  YYSTYPE yyvs;
-  };
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack)					\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack, Stack, yysize);				\
-	Stack = &yyptr->Stack;						\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  8
 /* YYLAST -- Last index in YYTABLE.  */
@@ -416,18 +480,23 @@ union yyalloc
 #define YYNNTS  11
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  37
-/* YYNRULES -- Number of states.  */
+/* YYNSTATES -- Number of states.  */
 #define YYNSTATES  101
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   284
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -461,120 +530,56 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint8 yyprhs[] =
-{
-       0,     0,     3,     5,     8,    10,    13,    20,    29,    32,
-      33,    43,    47,    53,    57,    59,    60,    64,    68,    76,
-      82,    86,    93,   102,   108,   111,   114,   117,   121,   123,
-     125,   127,   129,   131,   135,   137,   138,   146
-};
-
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int8 yyrhs[] =
-{
-      38,     0,    -1,    39,    -1,    39,    40,    -1,    40,    -1,
-       1,    30,    -1,     3,    24,    31,    41,    32,    30,    -1,
-       3,    24,     4,    24,    31,    41,    32,    30,    -1,    41,
-      42,    -1,    -1,    25,    33,    43,    34,    35,    24,    31,
-      45,    32,    -1,    25,    35,    24,    -1,    25,    35,    24,
-      20,    45,    -1,    43,    36,    44,    -1,    44,    -1,    -1,
-      25,    35,    24,    -1,    25,    20,    45,    -1,     5,    45,
-       6,    45,     7,    45,     8,    -1,    11,    45,    12,    45,
-      13,    -1,    31,    46,    32,    -1,     9,    25,    35,    24,
-      10,    45,    -1,     9,    25,    35,    24,    20,    45,    10,
-      45,    -1,    14,    45,    15,    47,    17,    -1,    18,    24,
-      -1,    19,    45,    -1,    21,    45,    -1,    33,    45,    34,
-      -1,    25,    -1,    26,    -1,    23,    -1,    28,    -1,    29,
-      -1,    46,    30,    45,    -1,    45,    -1,    -1,    47,    25,
-      35,    24,    16,    45,    30,    -1,    25,    35,    24,    16,
-      45,    30,    -1
-};
-
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint8 yyrline[] =
 {
-       0,    59,    59,    62,    63,    64,    71,    73,    78,    79,
-      82,    84,    86,    90,    91,    92,    95,    98,    99,   100,
-     101,   102,   104,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   118,   119,   120,   123,   125
+       0,    82,    82,    85,    86,    87,    94,    96,   101,   102,
+     105,   107,   109,   113,   114,   115,   118,   121,   122,   123,
+     124,   125,   127,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   141,   142,   143,   146,   148
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "CLASS", "INHERITS", "IF", "THEN",
-  "ELSE", "FI", "LET", "IN", "WHILE", "LOOP", "POOL", "CASE", "OF",
-  "DARROW", "ESAC", "NEW", "ISVOID", "ASSIGN", "NOT", "LTE", "STRING",
-  "TYPE", "ID", "INTEGER", "BOOLEAN", "TRUE", "FALSE", "';'", "'{'", "'}'",
-  "'('", "')'", "':'", "','", "$accept", "program", "class_list", "class",
-  "feature_list", "feature", "formal_list", "formal", "expr", "expr_list",
-  "case_list", 0
+  "\"end of file\"", "error", "\"invalid token\"", "CLASS", "INHERITS",
+  "IF", "THEN", "ELSE", "FI", "LET", "IN", "WHILE", "LOOP", "POOL", "CASE",
+  "OF", "DARROW", "ESAC", "NEW", "ISVOID", "ASSIGN", "NOT", "LTE",
+  "STRING", "TYPE", "ID", "INTEGER", "BOOLEAN", "TRUE", "FALSE", "';'",
+  "'{'", "'}'", "'('", "')'", "':'", "','", "$accept", "program",
+  "class_list", "class", "feature_list", "feature", "formal_list",
+  "formal", "expr", "expr_list", "case_list", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-      59,   123,   125,    40,    41,    58,    44
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,    37,    38,    39,    39,    39,    40,    40,    41,    41,
-      42,    42,    42,    43,    43,    43,    44,    45,    45,    45,
-      45,    45,    45,    45,    45,    45,    45,    45,    45,    45,
-      45,    45,    45,    46,    46,    46,    47,    47
-};
+#define YYPACT_NINF (-36)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     1,     2,     1,     2,     6,     8,     2,     0,
-       9,     3,     5,     3,     1,     0,     3,     3,     7,     5,
-       3,     6,     8,     5,     2,     2,     2,     3,     1,     1,
-       1,     1,     1,     3,     1,     0,     7,     6
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint8 yydefact[] =
-{
-       0,     0,     0,     0,     2,     4,     5,     0,     1,     3,
-       0,     9,     0,     0,     9,     0,     0,     8,     0,    15,
-       0,     6,     0,     0,     0,    14,    11,     7,     0,     0,
-       0,     0,    16,     0,    13,     0,     0,     0,     0,     0,
-       0,     0,    30,    28,    29,    31,    32,    35,     0,    12,
-       0,     0,     0,     0,     0,    24,    25,    26,     0,    34,
-       0,     0,     0,     0,     0,     0,     0,    17,     0,    20,
-      27,     0,     0,     0,     0,     0,     0,    33,    10,     0,
-       0,     0,    19,     0,    23,     0,     0,    21,     0,     0,
-       0,    18,     0,     0,     0,    22,     0,     0,    37,     0,
-      36
-};
+#define YYTABLE_NINF (-1)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
-{
-      -1,     3,     4,     5,    13,    17,    24,    25,    49,    60,
-      76
-};
+#define yytable_value_is_error(Yyn) \
+  0
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -36
 static const yytype_int8 yypact[] =
 {
       17,   -22,     1,    14,    23,   -36,   -36,     0,   -36,   -36,
@@ -590,6 +595,24 @@ static const yytype_int8 yypact[] =
      -36
 };
 
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       0,     0,     0,     0,     2,     4,     5,     0,     1,     3,
+       0,     9,     0,     0,     9,     0,     0,     8,     0,    15,
+       0,     6,     0,     0,     0,    14,    11,     7,     0,     0,
+       0,     0,    16,     0,    13,     0,     0,     0,     0,     0,
+       0,     0,    30,    28,    29,    31,    32,    35,     0,    12,
+       0,     0,     0,     0,     0,    24,    25,    26,     0,    34,
+       0,     0,     0,     0,     0,     0,     0,    17,     0,    20,
+      27,     0,     0,     0,     0,     0,     0,    33,    10,     0,
+       0,     0,    19,     0,    23,     0,     0,    21,     0,     0,
+       0,    18,     0,     0,     0,    22,     0,     0,    37,     0,
+      36
+};
+
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
@@ -597,12 +620,17 @@ static const yytype_int8 yypgoto[] =
      -36
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -1
-static const yytype_uint8 yytable[] =
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     3,     4,     5,    13,    17,    24,    25,    49,    60,
+      76
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
 {
       51,    80,    53,    54,    10,    56,    57,    84,     6,    15,
       15,    81,    59,    61,     8,    85,    16,    22,     1,    19,
@@ -630,9 +658,9 @@ static const yytype_int8 yycheck[] =
       14,    -1,    30
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
        0,     1,     3,    38,    39,    40,    30,    24,     0,    40,
        4,    31,    24,    41,    31,    25,    32,    42,    41,    33,
@@ -647,95 +675,59 @@ static const yytype_uint8 yystos[] =
       30
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    37,    38,    39,    39,    39,    40,    40,    41,    41,
+      42,    42,    42,    43,    43,    43,    44,    45,    45,    45,
+      45,    45,    45,    45,    45,    45,    45,    45,    45,    45,
+      45,    45,    45,    46,    46,    46,    47,    47
+};
 
-#define YYFAIL		goto yyerrlab
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     1,     2,     6,     8,     2,     0,
+       9,     3,     5,     3,     1,     0,     3,     3,     7,     5,
+       3,     6,     8,     5,     2,     2,     2,     3,     1,     1,
+       1,     1,     1,     3,     1,     0,     7,     6
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
-   This macro was not mandated originally: define only if we know
-   we won't break user code: when these are the locations we know.  */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
-#  define YY_LOCATION_PRINT(File, Loc)			\
-     fprintf (File, "%d.%d-%d.%d",			\
-	      (Loc).first_line, (Loc).first_column,	\
-	      (Loc).last_line,  (Loc).last_column)
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
 
+#define YYRECOVERING()  (!!yyerrstatus)
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (ctx, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -745,80 +737,59 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, ctx); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, cool_parse_t *ctx)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (ctx);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
-static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, cool_parse_t *ctx)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, ctx);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -826,80 +797,68 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *bottom, yytype_int16 *top)
-#else
 static void
-yy_stack_print (bottom, top)
-    yytype_int16 *bottom;
-    yytype_int16 *top;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
-  for (; bottom <= top; ++bottom)
-    YYFPRINTF (stderr, " %d", *bottom);
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, cool_parse_t *ctx)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
-      fprintf (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
-      fprintf (stderr, "\n");
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], ctx);
+      YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, ctx); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -913,479 +872,344 @@ int yydebug;
 #ifndef YYMAXDEPTH
 # define YYMAXDEPTH 10000
 #endif
+/* Parser data structure.  */
+struct yypstate
+  {
+    /* Number of syntax errors so far.  */
+    int yynerrs;
+
+    yy_state_fast_t yystate;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss;
+    yy_state_t *yyssp;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs;
+    YYSTYPE *yyvsp;
+    /* Whether this instance has not started parsing yet.
+     * If 2, it corresponds to a finished parsing.  */
+    int yynew;
+  };
 
-
-
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
 
-  if (! yyres)
-    return yystrlen (yystr);
 
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into YYRESULT an error message about the unexpected token
-   YYCHAR while in state YYSTATE.  Return the number of bytes copied,
-   including the terminating null byte.  If YYRESULT is null, do not
-   copy anything; just return the number of bytes that would be
-   copied.  As a special case, return 0 if an ordinary "syntax error"
-   message will do.  Return YYSIZE_MAXIMUM if overflow occurs during
-   size calculation.  */
-static YYSIZE_T
-yysyntax_error (char *yyresult, int yystate, int yychar)
-{
-  int yyn = yypact[yystate];
 
-  if (! (YYPACT_NINF < yyn && yyn <= YYLAST))
-    return 0;
-  else
-    {
-      int yytype = YYTRANSLATE (yychar);
-      YYSIZE_T yysize0 = yytnamerr (0, yytname[yytype]);
-      YYSIZE_T yysize = yysize0;
-      YYSIZE_T yysize1;
-      int yysize_overflow = 0;
-      enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-      char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-      int yyx;
-
-# if 0
-      /* This is so xgettext sees the translatable formats that are
-	 constructed on the fly.  */
-      YY_("syntax error, unexpected %s");
-      YY_("syntax error, unexpected %s, expecting %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s");
-# endif
-      char *yyfmt;
-      char const *yyf;
-      static char const yyunexpected[] = "syntax error, unexpected %s";
-      static char const yyexpecting[] = ", expecting %s";
-      static char const yyor[] = " or %s";
-      char yyformat[sizeof yyunexpected
-		    + sizeof yyexpecting - 1
-		    + ((YYERROR_VERBOSE_ARGS_MAXIMUM - 2)
-		       * (sizeof yyor - 1))];
-      char const *yyprefix = yyexpecting;
-
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-	 YYCHECK.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yycount = 1;
-
-      yyarg[0] = yytname[yytype];
-      yyfmt = yystpcpy (yyformat, yyunexpected);
-
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-	if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	  {
-	    if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-	      {
-		yycount = 1;
-		yysize = yysize0;
-		yyformat[sizeof yyunexpected - 1] = '\0';
-		break;
-	      }
-	    yyarg[yycount++] = yytname[yyx];
-	    yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-	    yysize_overflow |= (yysize1 < yysize);
-	    yysize = yysize1;
-	    yyfmt = yystpcpy (yyfmt, yyprefix);
-	    yyprefix = yyor;
-	  }
-
-      yyf = YY_(yyformat);
-      yysize1 = yysize + yystrlen (yyf);
-      yysize_overflow |= (yysize1 < yysize);
-      yysize = yysize1;
-
-      if (yysize_overflow)
-	return YYSIZE_MAXIMUM;
-
-      if (yyresult)
-	{
-	  /* Avoid sprintf, as that infringes on the user's name space.
-	     Don't have undefined behavior even if the translation
-	     produced a string with the wrong number of "%s"s.  */
-	  char *yyp = yyresult;
-	  int yyi = 0;
-	  while ((*yyp = *yyf) != '\0')
-	    {
-	      if (*yyp == '%' && yyf[1] == 's' && yyi < yycount)
-		{
-		  yyp += yytnamerr (yyp, yyarg[yyi++]);
-		  yyf += 2;
-		}
-	      else
-		{
-		  yyp++;
-		  yyf++;
-		}
-	    }
-	}
-      return yysize;
-    }
-}
-#endif /* YYERROR_VERBOSE */
-
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, cool_parse_t *ctx)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
+  YY_USE (ctx);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
-
 
-/* Prevent warnings from -Wmissing-prototypes.  */
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
 
 
-/* The look-ahead symbol.  */
-int yychar;
-
-/* The semantic value of the look-ahead symbol.  */
-YYSTYPE yylval;
+int
+yyparse (cool_parse_t *ctx)
+{
+  yypstate *yyps = yypstate_new ();
+  if (!yyps)
+    {
+      yyerror (ctx, YY_("memory exhausted"));
+      return 2;
+    }
+  int yystatus = yypull_parse (yyps, ctx);
+  yypstate_delete (yyps);
+  return yystatus;
+}
 
-/* Number of syntax errors so far.  */
-int yynerrs;
+int
+yypull_parse (yypstate *yyps, cool_parse_t *ctx)
+{
+  YY_ASSERT (yyps);
+  int yystatus;
+  do {
+    YYSTYPE yylval;
+    int yychar = yylex (&yylval, ctx);
+    yystatus = yypush_parse (yyps, yychar, &yylval, ctx);
+  } while (yystatus == YYPUSH_MORE);
+  return yystatus;
+}
 
+#define yynerrs yyps->yynerrs
+#define yystate yyps->yystate
+#define yyerrstatus yyps->yyerrstatus
+#define yyssa yyps->yyssa
+#define yyss yyps->yyss
+#define yyssp yyps->yyssp
+#define yyvsa yyps->yyvsa
+#define yyvs yyps->yyvs
+#define yyvsp yyps->yyvsp
+#define yystacksize yyps->yystacksize
+
+/* Initialize the parser data structure.  */
+static void
+yypstate_clear (yypstate *yyps)
+{
+  yynerrs = 0;
+  yystate = 0;
+  yyerrstatus = 0;
 
+  yyssp = yyss;
+  yyvsp = yyvs;
 
-/*----------.
-| yyparse.  |
-`----------*/
+  /* Initialize the state stack, in case yypcontext_expected_tokens is
+     called before the first call to yyparse. */
+  *yyssp = 0;
+  yyps->yynew = 1;
+}
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void)
-#else
-int
-yyparse ()
+/* Initialize the parser data structure.  */
+yypstate *
+yypstate_new (void)
+{
+  yypstate *yyps;
+  yyps = YY_CAST (yypstate *, YYMALLOC (sizeof *yyps));
+  if (!yyps)
+    return YY_NULLPTR;
+  yystacksize = YYINITDEPTH;
+  yyss = yyssa;
+  yyvs = yyvsa;
+  yypstate_clear (yyps);
+  return yyps;
+}
 
-#endif
-#endif
+void
+yypstate_delete (yypstate *yyps)
 {
-  
-  int yystate;
-  int yyn;
-  int yyresult;
-  /* Number of tokens to shift before error messages enabled.  */
-  int yyerrstatus;
-  /* Look-ahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
+  if (yyps)
+    {
+#ifndef yyoverflow
+      /* If the stack was reallocated but the parse did not complete, then the
+         stack still needs to be freed.  */
+      if (yyss != yyssa)
+        YYSTACK_FREE (yyss);
 #endif
+      YYFREE (yyps);
+    }
+}
 
-  /* Three stacks and their tools:
-     `yyss': related to states,
-     `yyvs': related to semantic values,
-     `yyls': related to locations.
-
-     Refer to the stacks thru separate pointers, to allow yyoverflow
-     to reallocate them elsewhere.  */
-
-  /* The state stack.  */
-  yytype_int16 yyssa[YYINITDEPTH];
-  yytype_int16 *yyss = yyssa;
-  yytype_int16 *yyssp;
 
-  /* The semantic value stack.  */
-  YYSTYPE yyvsa[YYINITDEPTH];
-  YYSTYPE *yyvs = yyvsa;
-  YYSTYPE *yyvsp;
 
+/*---------------.
+| yypush_parse.  |
+`---------------*/
 
+int
+yypush_parse (yypstate *yyps,
+              int yypushed_char, YYSTYPE const *yypushed_val, cool_parse_t *ctx)
+{
+/* Lookahead token kind.  */
+int yychar;
 
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
-  YYSIZE_T yystacksize = YYINITDEPTH;
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
 
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
   /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  YYDPRINTF ((stderr, "Starting parse\n"));
+  switch (yyps->yynew)
+    {
+    case 0:
+      yyn = yypact[yystate];
+      goto yyread_pushed_token;
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
+    case 2:
+      yypstate_clear (yyps);
+      break;
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
+    default:
+      break;
+    }
 
-  yyssp = yyss;
-  yyvsp = yyvs;
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss);
-	YYSTACK_RELOCATE (yyvs);
-
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
-     look-ahead token if we need one and don't already have one.  */
+     lookahead token if we need one and don't already have one.  */
 
-  /* First try to decide what to do without reference to look-ahead token.  */
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
-  /* Not known => get a look-ahead token if don't already have one.  */
+  /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid look-ahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      if (!yyps->yynew)
+        {
+          YYDPRINTF ((stderr, "Return for a new token:\n"));
+          yyresult = YYPUSH_MORE;
+          goto yypushreturn;
+        }
+      yyps->yynew = 0;
+yyread_pushed_token:
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yypushed_char;
+      if (yypushed_val)
+        yylval = *yypushed_val;
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1400,30 +1224,26 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
   /* Count tokens shifted since error; after three, turn off error
      status.  */
   if (yyerrstatus)
     yyerrstatus--;
 
-  /* Shift the look-ahead token.  */
+  /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1438,14 +1258,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -1458,286 +1278,297 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 59 "cool.y"
-    { program = (yyvsp[(1) - (1)].class_list); ;}
+  case 2: /* program: class_list  */
+#line 82 "cool.y"
+                    { ctx->program = finish_class_list((yyvsp[0].class_list)); }
+#line 1285 "cool.tab.c"
     break;
 
-  case 3:
-#line 62 "cool.y"
-    { (yyval.class_list) = append_class_list((yyvsp[(1) - (2)].class_list), (yyvsp[(2) - (2)].class)); ;}
+  case 3: /* class_list: class_list class  */
+#line 85 "cool.y"
+                             { (yyval.class_list) = append_class_list(&ctx->ast, (yyvsp[-1].class_list), (yyvsp[0].class)); }
+#line 1291 "cool.tab.c"
     break;
 
-  case 4:
-#line 63 "cool.y"
-    { (yyval.class_list) = create_class_list((yyvsp[(1) - (1)].class)); ;}
+  case 4: /* class_list: class  */
+#line 86 "cool.y"
+                  { (yyval.class_list) = create_class_list(&ctx->ast, (yyvsp[0].class)); }
+#line 1297 "cool.tab.c"
     break;
 
-  case 5:
-#line 64 "cool.y"
-    {
-                yyerror("Error in class definition, skipping.");
+  case 5: /* class_list: error ';'  */
+#line 87 "cool.y"
+                      {
+                report(ctx, "Error in class definition, skipping.", yychar > 0);
                 yyerrok; // 에러 복구
                 (yyval.class_list) = NULL;
-          ;}
+          }
+#line 1307 "cool.tab.c"
     break;
 
-  case 6:
-#line 72 "cool.y"
-    { (yyval.class) = create_class((yyvsp[(2) - (6)].s), NULL, (yyvsp[(4) - (6)].feature_list)); ;}
+  case 6: /* class: CLASS TYPE '{' feature_list '}' ';'  */
+#line 95 "cool.y"
+    { (yyval.class) = class_done(ctx, create_class(&ctx->ast, (yyvsp[-4].s), NULL, finish_feature_list((yyvsp[-2].feature_list)))); }
+#line 1313 "cool.tab.c"
     break;
 
-  case 7:
-#line 74 "cool.y"
-    { (yyval.class) = create_class((yyvsp[(2) - (8)].s), (yyvsp[(4) - (8)].s), (yyvsp[(6) - (8)].feature_list)); ;}
+  case 7: /* class: CLASS TYPE INHERITS TYPE '{' feature_list '}' ';'  */
+#line 97 "cool.y"
+    { (yyval.class) = class_done(ctx, create_class(&ctx->ast, (yyvsp[-6].s), (yyvsp[-4].s), finish_feature_list((yyvsp[-2].feature_list)))); }
+#line 1319 "cool.tab.c"
     break;
 
-  case 8:
-#line 78 "cool.y"
-    { (yyval.feature_list) = append_feature_list((yyvsp[(1) - (2)].feature_list), (yyvsp[(2) - (2)].feature)); ;}
+  case 8: /* feature_list: feature_list feature  */
+#line 101 "cool.y"
+                                   { (yyval.feature_list) = append_feature_list(&ctx->ast, (yyvsp[-1].feature_list), (yyvsp[0].feature)); }
+#line 1325 "cool.tab.c"
     break;
 
-  case 9:
-#line 79 "cool.y"
-    { (yyval.feature_list) = NULL; ;}
+  case 9: /* feature_list: %empty  */
+#line 102 "cool.y"
+                          { (yyval.feature_list) = NULL; }
+#line 1331 "cool.tab.c"
     break;
 
-  case 10:
-#line 83 "cool.y"
-    { (yyval.feature) = create_method((yyvsp[(1) - (9)].s), (yyvsp[(3) - (9)].formal_list), (yyvsp[(6) - (9)].s), (yyvsp[(8) - (9)].expr)); ;}
+  case 10: /* feature: ID '(' formal_list ')' ':' TYPE '{' expr '}'  */
+#line 106 "cool.y"
+    { (yyval.feature) = create_method(&ctx->ast, (yyvsp[-8].s), finish_formal_list((yyvsp[-6].formal_list)), (yyvsp[-3].s), (yyvsp[-1].expr)); }
+#line 1337 "cool.tab.c"
     break;
 
-  case 11:
-#line 85 "cool.y"
-    { (yyval.feature) = create_attribute((yyvsp[(1) - (3)].s), (yyvsp[(3) - (3)].s), NULL); ;}
+  case 11: /* feature: ID ':' TYPE  */
+#line 108 "cool.y"
+    { (yyval.feature) = create_attribute(&ctx->ast, (yyvsp[-2].s), (yyvsp[0].s), NULL); }
+#line 1343 "cool.tab.c"
     break;
 
-  case 12:
-#line 87 "cool.y"
-    { (yyval.feature) = create_attribute((yyvsp[(1) - (5)].s), (yyvsp[(3) - (5)].s), (yyvsp[(5) - (5)].expr)); ;}
+  case 12: /* feature: ID ':' TYPE ASSIGN expr  */
+#line 110 "cool.y"
+    { (yyval.feature) = create_attribute(&ctx->ast, (yyvsp[-4].s), (yyvsp[-2].s), (yyvsp[0].expr)); }
+#line 1349 "cool.tab.c"
     break;
 
-  case 13:
-#line 90 "cool.y"
-    { (yyval.formal_list) = append_formal_list((yyvsp[(1) - (3)].formal_list), (yyvsp[(3) - (3)].formal)); ;}
+  case 13: /* formal_list: formal_list ',' formal  */
+#line 113 "cool.y"
+                                    { (yyval.formal_list) = append_formal_list(&ctx->ast, (yyvsp[-2].formal_list), (yyvsp[0].formal)); }
+#line 1355 "cool.tab.c"
     break;
 
-  case 14:
-#line 91 "cool.y"
-    { (yyval.formal_list) = create_formal_list((yyvsp[(1) - (1)].formal)); ;}
+  case 14: /* formal_list: formal  */
+#line 114 "cool.y"
+                    { (yyval.formal_list) = create_formal_list(&ctx->ast, (yyvsp[0].formal)); }
+#line 1361 "cool.tab.c"
     break;
 
-  case 15:
-#line 92 "cool.y"
-    { (yyval.formal_list) = NULL; ;}
+  case 15: /* formal_list: %empty  */
+#line 115 "cool.y"
+                         { (yyval.formal_list) = NULL; }
+#line 1367 "cool.tab.c"
     break;
 
-  case 16:
-#line 95 "cool.y"
-    { (yyval.formal) = create_formal((yyvsp[(1) - (3)].s), (yyvsp[(3) - (3)].s)); ;}
+  case 16: /* formal: ID ':' TYPE  */
+#line 118 "cool.y"
+                    { (yyval.formal) = create_formal(&ctx->ast, (yyvsp[-2].s), (yyvsp[0].s)); }
+#line 1373 "cool.tab.c"
     break;
 
-  case 17:
-#line 98 "cool.y"
-    { (yyval.expr) = create_assign_expr((yyvsp[(1) - (3)].s), (yyvsp[(3) - (3)].expr)); ;}
+  case 17: /* expr: ID ASSIGN expr  */
+#line 121 "cool.y"
+                     { (yyval.expr) = create_assign_expr(&ctx->ast, (yyvsp[-2].s), (yyvsp[0].expr)); }
+#line 1379 "cool.tab.c"
     break;
 
-  case 18:
-#line 99 "cool.y"
-    { (yyval.expr) = create_if_expr((yyvsp[(2) - (7)].expr), (yyvsp[(4) - (7)].expr), (yyvsp[(6) - (7)].expr)); ;}
+  case 18: /* expr: IF expr THEN expr ELSE expr FI  */
+#line 122 "cool.y"
+                                     { (yyval.expr) = create_if_expr(&ctx->ast, (yyvsp[-5].expr), (yyvsp[-3].expr), (yyvsp[-1].expr)); }
+#line 1385 "cool.tab.c"
     break;
 
-  case 19:
-#line 100 "cool.y"
-    { (yyval.expr) = create_while_expr((yyvsp[(2) - (5)].expr), (yyvsp[(4) - (5)].expr)); ;}
+  case 19: /* expr: WHILE expr LOOP expr POOL  */
+#line 123 "cool.y"
+                                { (yyval.expr) = create_while_expr(&ctx->ast, (yyvsp[-3].expr), (yyvsp[-1].expr)); }
+#line 1391 "cool.tab.c"
     break;
 
-  case 20:
-#line 101 "cool.y"
-    { (yyval.expr) = create_block_expr((yyvsp[(2) - (3)].expr_list)); ;}
+  case 20: /* expr: '{' expr_list '}'  */
+#line 124 "cool.y"
+                        { (yyval.expr) = create_block_expr(&ctx->ast, finish_expr_list((yyvsp[-1].expr_list))); }
+#line 1397 "cool.tab.c"
     break;
 
-  case 21:
-#line 103 "cool.y"
-    { (yyval.expr) = create_let_expr((yyvsp[(2) - (6)].s), (yyvsp[(4) - (6)].s), NULL, (yyvsp[(6) - (6)].expr)); ;}
+  case 21: /* expr: LET ID ':' TYPE IN expr  */
+#line 126 "cool.y"
+    { (yyval.expr) = create_let_expr(&ctx->ast, (yyvsp[-4].s), (yyvsp[-2].s), NULL, (yyvsp[0].expr)); }
+#line 1403 "cool.tab.c"
     break;
 
-  case 22:
-#line 105 "cool.y"
-    { (yyval.expr) = create_let_expr((yyvsp[(2) - (8)].s), (yyvsp[(4) - (8)].s), (yyvsp[(6) - (8)].expr), (yyvsp[(8) - (8)].expr)); ;}
+  case 22: /* expr: LET ID ':' TYPE ASSIGN expr IN expr  */
+#line 128 "cool.y"
+    { (yyval.expr) = create_let_expr(&ctx->ast, (yyvsp[-6].s), (yyvsp[-4].s), (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 1409 "cool.tab.c"
     break;
 
-  case 23:
-#line 106 "cool.y"
-    { (yyval.expr) = create_case_expr((yyvsp[(2) - (5)].expr), (yyvsp[(4) - (5)].case_list)); ;}
+  case 23: /* expr: CASE expr OF case_list ESAC  */
+#line 129 "cool.y"
+                                  { (yyval.expr) = create_case_expr(&ctx->ast, (yyvsp[-3].expr), finish_case_list((yyvsp[-1].case_list))); }
+#line 1415 "cool.tab.c"
     break;
 
-  case 24:
-#line 107 "cool.y"
-    { (yyval.expr) = create_new_expr((yyvsp[(2) - (2)].s)); ;}
+  case 24: /* expr: NEW TYPE  */
+#line 130 "cool.y"
+               { (yyval.expr) = create_new_expr(&ctx->ast, (yyvsp[0].s)); }
+#line 1421 "cool.tab.c"
     break;
 
-  case 25:
-#line 108 "cool.y"
-    { (yyval.expr) = create_isvoid_expr((yyvsp[(2) - (2)].expr)); ;}
+  case 25: /* expr: ISVOID expr  */
+#line 131 "cool.y"
+                  { (yyval.expr) = create_isvoid_expr(&ctx->ast, (yyvsp[0].expr)); }
+#line 1427 "cool.tab.c"
     break;
 
-  case 26:
-#line 109 "cool.y"
-    { (yyval.expr) = create_not_expr((yyvsp[(2) - (2)].expr)); ;}
+  case 26: /* expr: NOT expr  */
+#line 132 "cool.y"
+               { (yyval.expr) = create_not_expr(&ctx->ast, (yyvsp[0].expr)); }
+#line 1433 "cool.tab.c"
     break;
 
-  case 27:
-#line 110 "cool.y"
-    { (yyval.expr) = (yyvsp[(2) - (3)].expr); ;}
+  case 27: /* expr: '(' expr ')'  */
+#line 133 "cool.y"
+                   { (yyval.expr) = (yyvsp[-1].expr); }
+#line 1439 "cool.tab.c"
     break;
 
-  case 28:
-#line 111 "cool.y"
-    { (yyval.expr) = create_object_expr((yyvsp[(1) - (1)].s)); ;}
+  case 28: /* expr: ID  */
+#line 134 "cool.y"
+         { (yyval.expr) = create_object_expr(&ctx->ast, (yyvsp[0].s)); }
+#line 1445 "cool.tab.c"
     break;
 
-  case 29:
-#line 112 "cool.y"
-    { (yyval.expr) = create_int_expr((yyvsp[(1) - (1)].i)); ;}
+  case 29: /* expr: INTEGER  */
+#line 135 "cool.y"
+              { (yyval.expr) = create_int_expr(&ctx->ast, (yyvsp[0].i)); }
+#line 1451 "cool.tab.c"
     break;
 
-  case 30:
-#line 113 "cool.y"
-    { (yyval.expr) = create_string_expr((yyvsp[(1) - (1)].s)); ;}
+  case 30: /* expr: STRING  */
+#line 136 "cool.y"
+             { (yyval.expr) = create_string_expr(&ctx->ast, (yyvsp[0].str).ptr, (yyvsp[0].str).len); }
+#line 1457 "cool.tab.c"
     break;
 
-  case 31:
-#line 114 "cool.y"
-    { (yyval.expr) = create_bool_expr(true); ;}
+  case 31: /* expr: TRUE  */
+#line 137 "cool.y"
+           { (yyval.expr) = create_bool_expr(&ctx->ast, true); }
+#line 1463 "cool.tab.c"
     break;
 
-  case 32:
-#line 115 "cool.y"
-    { (yyval.expr) = create_bool_expr(false); ;}
+  case 32: /* expr: FALSE  */
+#line 138 "cool.y"
+            { (yyval.expr) = create_bool_expr(&ctx->ast, false); }
+#line 1469 "cool.tab.c"
     break;
 
-  case 33:
-#line 118 "cool.y"
-    { (yyval.expr_list) = append_expr_list((yyvsp[(1) - (3)].expr_list), (yyvsp[(3) - (3)].expr)); ;}
+  case 33: /* expr_list: expr_list ';' expr  */
+#line 141 "cool.y"
+                              { (yyval.expr_list) = append_expr_list(&ctx->ast, (yyvsp[-2].expr_list), (yyvsp[0].expr)); }
+#line 1475 "cool.tab.c"
     break;
 
-  case 34:
-#line 119 "cool.y"
-    { (yyval.expr_list) = create_expr_list((yyvsp[(1) - (1)].expr)); ;}
+  case 34: /* expr_list: expr  */
+#line 142 "cool.y"
+                { (yyval.expr_list) = create_expr_list(&ctx->ast, (yyvsp[0].expr)); }
+#line 1481 "cool.tab.c"
     break;
 
-  case 35:
-#line 120 "cool.y"
-    { (yyval.expr_list) = NULL; ;}
+  case 35: /* expr_list: %empty  */
+#line 143 "cool.y"
+                       { (yyval.expr_list) = NULL; }
+#line 1487 "cool.tab.c"
     break;
 
-  case 36:
-#line 124 "cool.y"
-    { (yyval.case_list) = append_case_list((yyvsp[(1) - (7)].case_list), create_case((yyvsp[(2) - (7)].s), (yyvsp[(4) - (7)].s), (yyvsp[(6) - (7)].expr))); ;}
+  case 36: /* case_list: case_list ID ':' TYPE DARROW expr ';'  */
+#line 147 "cool.y"
+    { (yyval.case_list) = append_case_list(&ctx->ast, (yyvsp[-6].case_list), create_case(&ctx->ast, (yyvsp[-5].s), (yyvsp[-3].s), (yyvsp[-1].expr))); }
+#line 1493 "cool.tab.c"
     break;
 
-  case 37:
-#line 126 "cool.y"
-    { (yyval.case_list) = create_case_list(create_case((yyvsp[(1) - (6)].s), (yyvsp[(3) - (6)].s), (yyvsp[(5) - (6)].expr))); ;}
+  case 37: /* case_list: ID ':' TYPE DARROW expr ';'  */
+#line 149 "cool.y"
+    { (yyval.case_list) = create_case_list(&ctx->ast, create_case(&ctx->ast, (yyvsp[-5].s), (yyvsp[-3].s), (yyvsp[-1].expr))); }
+#line 1499 "cool.tab.c"
     break;
 
 
-/* Line 1267 of yacc.c.  */
-#line 1648 "cool.tab.c"
+#line 1503 "cool.tab.c"
+
       default: break;
     }
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-      {
-	YYSIZE_T yysize = yysyntax_error (0, yystate, yychar);
-	if (yymsg_alloc < yysize && yymsg_alloc < YYSTACK_ALLOC_MAXIMUM)
-	  {
-	    YYSIZE_T yyalloc = 2 * yysize;
-	    if (! (yysize <= yyalloc && yyalloc <= YYSTACK_ALLOC_MAXIMUM))
-	      yyalloc = YYSTACK_ALLOC_MAXIMUM;
-	    if (yymsg != yymsgbuf)
-	      YYSTACK_FREE (yymsg);
-	    yymsg = (char *) YYSTACK_ALLOC (yyalloc);
-	    if (yymsg)
-	      yymsg_alloc = yyalloc;
-	    else
-	      {
-		yymsg = yymsgbuf;
-		yymsg_alloc = sizeof yymsgbuf;
-	      }
-	  }
-
-	if (0 < yysize && yysize <= yymsg_alloc)
-	  {
-	    (void) yysyntax_error (yymsg, yystate, yychar);
-	    yyerror (yymsg);
-	  }
-	else
-	  {
-	    yyerror (YY_("syntax error"));
-	    if (yysize != 0)
-	      goto yyexhaustedlab;
-	  }
-      }
-#endif
+      yyerror (ctx, YY_("syntax error"));
     }
 
-
-
   if (yyerrstatus == 3)
     {
-      /* If just tried and failed to reuse look-ahead token after an
-	 error, discard it.  */
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, ctx);
+          yychar = YYEMPTY;
+        }
     }
 
-  /* Else will try to reuse look-ahead token after shifting the error
+  /* Else will try to reuse lookahead token after shifting the error
      token.  */
   goto yyerrlab1;
 
@@ -1746,14 +1577,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -1766,42 +1596,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, ctx);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -1812,91 +1642,434 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#ifndef yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (ctx, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
-  if (yychar != YYEOF && yychar != YYEMPTY)
-     yydestruct ("Cleanup: discarding lookahead",
-		 yytoken, &yylval);
-  /* Do not reclaim the symbols of the rule which action triggered
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, ctx);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, ctx);
       YYPOPSTACK (1);
     }
-#ifndef yyoverflow
-  if (yyss != yyssa)
-    YYSTACK_FREE (yyss);
-#endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
+  yyps->yynew = 2;
+  goto yypushreturn;
+
+
+/*-------------------------.
+| yypushreturn -- return.  |
+`-------------------------*/
+yypushreturn:
+
+  return yyresult;
 }
+#undef yynerrs
+#undef yystate
+#undef yyerrstatus
+#undef yyssa
+#undef yyss
+#undef yyssp
+#undef yyvsa
+#undef yyvs
+#undef yyvsp
+#undef yystacksize
+#line 152 "cool.y"
+
+
+/*
+ * 오류의 개수를 누적하고, 오류가 발생한 줄번호와 관련된 토큰을 출력한다.
+ * lookahead는 파서가 미리 읽어 둔 토큰이 있는지(입력 끝이 아닌지)이다.
+ */
+static void report(cool_parse_t *ctx, char const *s, int lookahead)
+{
+    int line;
 
+    ++ctx->num_errors;
+    if (ctx->speculative)
+        return;
+    line = cool_lexer_line(ctx->lexer, ctx->token.offset);
 
-#line 129 "cool.y"
+    if (lookahead)
+        printf("%s in line %d at \"%.*s\"\n", s, line, (int)ctx->token.len, ctx->token.text);
+    else
+        printf("%s in line %d (unexpected EOF)\n", s, line);
+}
 
+/* 구문 오류는 미리 읽은 토큰에서 발견되므로 마지막으로 읽은 토큰이 그 토큰이다 */
+static void yyerror(cool_parse_t *ctx, char const *s)
+{
+    report(ctx, s, ctx->token.kind > 0);
+}
 
-void yyerror(char const *s)
+/* 최상위 클래스 하나를 다 읽었음을 알린다 */
+static class_t *class_done(cool_parse_t *ctx, class_t *cls)
 {
-    /*
-     * 오류의 개수를 누적한다.
-     */
-    ++num_errors;
-    /*
-     * 문법 오류가 발생한 줄번호와 관련된 토큰을 출력한다.
-     */
-    if (yychar > 0)
-        printf("%s in line %d at \"%s\"\n", s, yylineno, yytext);
+    if (ctx->on_class)
+        ctx->on_class(ctx, cls);
+    return cls;
+}
+
+/* 토큰의 의미값을 lval에 채운다 */
+static void token_value(YYSTYPE *lval, const cool_token_t *token)
+{
+    if (token->name)
+        lval->s = token->name;
+    else if (token->kind == STRING) {
+        lval->str.ptr = token->str;
+        lval->str.len = token->str_len;
+    } else if (token->kind == INTEGER)
+        lval->i = token->value;
+}
+
+/*
+ * 파서가 다음 토큰을 요구하면 스캐너 인스턴스에서 하나를 읽어 온다.
+ * 파이프라인 모드에서는 스캐너 스레드가 큐에 넣어 둔 토큰을 꺼낸다.
+ * 식별자와 타입은 인턴된 이름을, 문자열과 정수 상수는 스캐너가 만든 내용과 값을
+ * 의미값으로 넘긴다.
+ */
+static int yylex(YYSTYPE *lval, cool_parse_t *ctx)
+{
+    if (ctx->queue)
+        tokq_pop(ctx->queue, &ctx->token);
+    else
+        cool_lexer_next(ctx->lexer, &ctx->token);
+    token_value(lval, &ctx->token);
+    return ctx->token.kind;
+}
+
+/* 문맥을 초기화한다. hugepages이면 트리의 노드를 큰 페이지로 받은 청크에 둔다(arena.h) */
+void cool_parse_init(cool_parse_t *ctx, int hugepages)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    if (hugepages)
+        arena_init_huge(&ctx->ast);
     else
-        printf("%s in line %d (unexpected EOF)\n", s, yylineno);
+        arena_init(&ctx->ast);
+}
+
+/*
+ * ctx->lexer에 열어 둔 스캐너의 입력을 파싱하여 트리를 ctx->program에 남기고 오류의
+ * 개수를 돌려준다. ctx->queue가 있으면 스캐너 대신 큐에서 토큰을 꺼낸다.
+ */
+int cool_parse(cool_parse_t *ctx)
+{
+    yyparse(ctx);
+    return ctx->num_errors;
+}
+
+/*
+ * 메모리에 있는 소스 buf를 파싱한다. 스캐너가 buf를 복사하므로 호출한 뒤 buf를 바로
+ * 다시 써도 된다. 스캐너를 만들 수 없으면 -1을 돌려준다.
+ */
+int cool_parse_buffer(cool_parse_t *ctx, const char *buf, size_t len)
+{
+    if (!(ctx->lexer = cool_lexer_open_buffer(buf, len)))
+        return -1;
+    return cool_parse(ctx);
+}
+
+/*
+ * 트리 전체와 스캐너를 돌려준다. 트리의 문자열 상수가 스캐너 버퍼를 가리키므로
+ * 트리를 다 쓴 뒤에 부른다.
+ */
+void cool_parse_release(cool_parse_t *ctx)
+{
+    arena_release(&ctx->ast);
+    if (ctx->lexer)
+        cool_lexer_close(ctx->lexer);
+    if (ctx->ps)
+        yypstate_delete(ctx->ps);
+    free(ctx->pending);
+    ctx->lexer = NULL;
+    ctx->program = NULL;
+    ctx->ps = NULL;
+    ctx->pending = NULL;
+    ctx->pending_len = ctx->pending_cap = 0;
+}
+
+/*
+ * 밀어 넣기 파싱을 시작한다. 토큰을 넘길 때는 줄번호를 구할 수 있도록 그 토큰을 만든
+ * 스캐너를 ctx->lexer에 두고 시작한다. ctx->lexer가 없으면 바이트를 받을 스캐너를 만든다.
+ * 시작할 수 없으면 -1을 돌려준다.
+ */
+int cool_push_begin(cool_parse_t *ctx)
+{
+    if (!ctx->lexer && !(ctx->lexer = cool_lexer_open_push()))
+        return -1;
+    if (!(ctx->ps = yypstate_new()))
+        return -1;
+    ctx->status = YYPUSH_MORE;
+    return 0;
+}
+
+/*
+ * 토큰 하나를 넘긴다. 토큰의 text는 다음 토큰을 넘길 때까지, str은 트리를 다 쓸 때까지
+ * 유효해야 한다. 파서가 입력을 더 받으면 0을, 입력 끝을 받았거나 복구할 수 없는 오류로
+ * 파싱이 끝났으면 1을 돌려준다. 끝난 뒤에 넘긴 토큰은 버린다.
+ */
+int cool_push_token(cool_parse_t *ctx, const cool_token_t *tok)
+{
+    YYSTYPE lval = { 0 };     /* 값이 없는 토큰(입력 끝 등)도 초기화된 값을 넘긴다 */
+
+    if (ctx->status != YYPUSH_MORE)
+        return 1;
+    ctx->token = *tok;
+    token_value(&lval, tok);
+    ctx->status = yypush_parse(ctx->ps, tok->kind, &lval, ctx);
+    return ctx->status != YYPUSH_MORE;
+}
+
+/*
+ * 줄바꿈 뒤나 입력 끝에서 끝나는 구간을 스캐너에 넘기고 그 토큰을 모두 파서에 넘긴다.
+ * 메모리가 없으면 더 진행할 수 없으므로 끝낸다.
+ */
+static void push_lines(cool_parse_t *ctx, const char *buf, size_t len)
+{
+    cool_token_t tok;
+
+    if (cool_lexer_feed(ctx->lexer, buf, len) < 0) {
+        perror("cool_parser");
+        exit(1);
+    }
+    while (ctx->status == YYPUSH_MORE && cool_lexer_next(ctx->lexer, &tok))
+        cool_push_token(ctx, &tok);
+}
+
+/* 줄이 끝나지 않은 바이트를 모아 둔다. 메모리가 없으면 더 진행할 수 없으므로 끝낸다 */
+static void keep_pending(cool_parse_t *ctx, const char *buf, size_t len)
+{
+    if (ctx->pending_len + len > ctx->pending_cap) {
+        size_t cap = ctx->pending_cap ? ctx->pending_cap : 4096;
+
+        while (cap < ctx->pending_len + len)
+            cap *= 2;
+        if (!(ctx->pending = realloc(ctx->pending, cap))) {
+            perror("cool_parser");
+            exit(1);
+        }
+        ctx->pending_cap = cap;
+    }
+    memcpy(ctx->pending + ctx->pending_len, buf, len);
+    ctx->pending_len += len;
+}
+
+/*
+ * 바이트 len개를 넘긴다. 렉심이 구간을 넘지 않도록 마지막 줄바꿈까지를 스캐너에 넘겨
+ * 그 토큰을 모두 파싱하고, 나머지는 다음 바이트와 이어 붙이도록 모아 둔다.
+ * 돌려주는 값은 cool_push_token()과 같다.
+ */
+int cool_push_bytes(cool_parse_t *ctx, const char *buf, size_t len)
+{
+    size_t n = len;
+
+    if (ctx->status != YYPUSH_MORE)
+        return 1;
+    while (n > 0 && buf[n - 1] != '\n')
+        n--;
+    if (n > 0) {
+        if (ctx->pending_len) {
+            keep_pending(ctx, buf, n);
+            push_lines(ctx, ctx->pending, ctx->pending_len);
+            ctx->pending_len = 0;
+        } else
+            push_lines(ctx, buf, n);
+    }
+    keep_pending(ctx, buf + n, len - n);
+    return ctx->status != YYPUSH_MORE;
+}
+
+/* 남은 바이트와 입력 끝을 넘겨 밀어 넣기 파싱을 끝내고 오류의 개수를 돌려준다 */
+int cool_push_end(cool_parse_t *ctx)
+{
+    cool_token_t tok = { 0 };
+
+    if (ctx->pending_len) {
+        push_lines(ctx, ctx->pending, ctx->pending_len);
+        ctx->pending_len = 0;
+    }
+    tok.offset = ctx->lexer->nextOffset;
+    tok.text = "";
+    cool_push_token(ctx, &tok);
+    yypstate_delete(ctx->ps);
+    ctx->ps = NULL;
+    return ctx->num_errors;
+}
+
+/* 스캐너 스레드. 입력 끝까지 토큰을 큐에 넣는다 */
+static void *lex_thread(void *arg)
+{
+    cool_parse_t *ctx = arg;
+    cool_token_t tok;
+
+    do {
+        cool_lexer_next(ctx->lexer, &tok);
+        tokq_push(ctx->queue, &tok);
+    } while (tok.kind != 0);
+    return NULL;
+}
+
+/*
+ * fd에서 읽히는 만큼씩 바이트를 밀어 넣어 파싱한다. 파이프로 들어오는 입력은 도착하는 대로
+ * 파싱되므로 입력이 끝나기를 기다리는 시간과 파싱 시간이 겹친다.
+ */
+static void push_input(cool_parse_t *ctx, int fd)
+{
+    static char buf[64 * 1024];
+    ssize_t n;
+
+    if (cool_push_begin(ctx) < 0) {
+        perror("cool_parser");
+        exit(1);
+    }
+    while ((n = read(fd, buf, sizeof(buf))) != 0) {
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("cool_parser");
+            exit(1);
+        }
+        if (cool_push_bytes(ctx, buf, (size_t)n))
+            break;
+    }
+    cool_push_end(ctx);
 }
 
 int main(int argc, char *argv[])
 {
+    static cool_parse_t ctx;
+    static tokq_t queue;
+    pthread_t lexer_thread;
+    int argi = 1, pipeline = 0, hugepages = 0, push = 0, parallel = 0, fd = STDIN_FILENO;
+
+    /*
+     * --pipeline은 스캐너를 별도 스레드에서 돌려 스캔과 파싱을 겹친다.
+     * --hugepages는 트리의 노드를 큰 페이지로 받은 청크에 둔다(arena.h).
+     * --push는 입력을 읽히는 대로 파서에 밀어 넣는다(cool_push_bytes).
+     * --parallel[=N]은 최상위 클래스 단위로 나누어 N개의 스레드로 파싱한다(parparse.h).
+     * N은 양의 정수이며, 없으면 온라인 CPU 수만큼 쓴다. --pipeline, --push, --parallel은
+     * 입력을 다루는 방식이 서로 달라 함께 쓸 수 없다.
+     */
+    for (; argi < argc; argi++) {
+        if (strcmp(argv[argi], "--pipeline") == 0)
+            pipeline = 1;
+        else if (strcmp(argv[argi], "--hugepages") == 0)
+            hugepages = 1;
+        else if (strcmp(argv[argi], "--push") == 0)
+            push = 1;
+        else if (strcmp(argv[argi], "--parallel") == 0)
+            parallel = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        else if (strncmp(argv[argi], "--parallel=", 11) == 0) {
+            const char *arg = argv[argi] + 11;
+            char *end;
+            long n;
+
+            /* strtol이 받는 공백, 부호와 int를 넘는 값도 거절한다 */
+            errno = 0;
+            n = strtol(arg, &end, 10);
+            if (!isdigit((unsigned char)*arg) || *end != '\0' || errno || n < 1 || n > INT_MAX) {
+                fprintf(stderr, "--parallel=N의 N은 양의 정수여야 합니다: %s\n", argv[argi]);
+                exit(1);
+            }
+            parallel = (int)n;
+        }
+        else
+            break;
+    }
+    if (pipeline + push + (parallel != 0) > 1) {
+        fprintf(stderr, "--pipeline, --push, --parallel은 함께 쓸 수 없습니다\n");
+        exit(1);
+    }
+    cool_parse_init(&ctx, hugepages);
     /*
      * 스캔할 COOL 파일을 연다. 파일명이 없으면 표준입력이 사용된다.
      */
-    if (argc > 1)
-        if (!(yyin = fopen(argv[1],"r"))) {
-            printf("\"%s\"는 잘못된 파일 경로입니다.\n", argv[1]);
+    if (push) {
+        if (argi < argc && (fd = open(argv[argi], O_RDONLY)) < 0) {
+            printf("\"%s\"는 잘못된 파일 경로입니다.\n", argv[argi]);
+            exit(1);
+        }
+        push_input(&ctx, fd);
+        if (fd != STDIN_FILENO)
+            close(fd);
+    } else if (argi < argc) {
+        if (!(ctx.lexer = cool_lexer_open_file(argv[argi]))) {
+            printf("\"%s\"는 잘못된 파일 경로입니다.\n", argv[argi]);
             exit(1);
         }
+    } else if (!(ctx.lexer = cool_lexer_open_stream(stdin))) {
+        perror("cool_parser");
+        exit(1);
+    }
+    /*
+     * 파이프라인은 파일을 버퍼로 매핑한 경우에만 쓴다. 스트림 입력은 flex가 버퍼를
+     * 다시 채우면서 큐에 남은 토큰의 렉심을 덮어쓰므로 파서가 직접 스캔한다.
+     */
+    if (pipeline && ctx.lexer->buf) {
+        tokq_init(&queue);
+        ctx.queue = &queue;
+        if (pthread_create(&lexer_thread, NULL, lex_thread, &ctx) != 0) {
+            perror("cool_parser");
+            exit(1);
+        }
+    }
     /*
      * 구문분석을 위해 수행한다.
      */
-    yyparse();
+    if (parallel)
+        cool_parse_parallel(&ctx, parallel);
+    else if (!push)
+        cool_parse(&ctx);
+    /*
+     * 파서가 입력 끝 전에 멈추었으면 스캐너 스레드가 끝날 수 있도록 남은 토큰을 비운다.
+     */
+    if (ctx.queue) {
+        while (ctx.token.kind != 0)
+            tokq_pop(ctx.queue, &ctx.token);
+        pthread_join(lexer_thread, NULL);
+    }
     /*
      * 오류의 개수를 출력한다.
      */
-    if (num_errors > 0)
-         printf("%d error(s) found\n", num_errors);
+    if (ctx.num_errors > 0)
+         printf("%d error(s) found\n", ctx.num_errors);
     else
-         show_class_list(program);
+         show_class_list(ctx.program);
+    /*
+     * 트리의 문자열 상수가 스캐너 버퍼를 가리키므로 출력이 끝난 뒤에 해제한다.
+     */
+    cool_parse_release(&ctx);
 
     return 0;
 }
@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton interface for Bison's Yacc-like parsers in C
+/* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,77 +31,72 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     CLASS = 258,
-     INHERITS = 259,
-     IF = 260,
-     THEN = 261,
-     ELSE = 262,
-     FI = 263,
-     LET = 264,
-     IN = 265,
-     WHILE = 266,
-     LOOP = 267,
-     POOL = 268,
-     CASE = 269,
-     OF = 270,
-     DARROW = 271,
-     ESAC = 272,
-     NEW = 273,
-     ISVOID = 274,
-     ASSIGN = 275,
-     NOT = 276,
-     LTE = 277,
-     STRING = 278,
-     TYPE = 279,
-     ID = 280,
-     INTEGER = 281,
-     BOOLEAN = 282,
-     TRUE = 283,
-     FALSE = 284
-   };
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_COOL_TAB_H_INCLUDED
+# define YY_YY_COOL_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
 #endif
-/* Tokens.  */
-#define CLASS 258
-#define INHERITS 259
-#define IF 260
-#define THEN 261
-#define ELSE 262
-#define FI 263
-#define LET 264
-#define IN 265
-#define WHILE 266
-#define LOOP 267
-#define POOL 268
-#define CASE 269
-#define OF 270
-#define DARROW 271
-#define ESAC 272
-#define NEW 273
-#define ISVOID 274
-#define ASSIGN 275
-#define NOT 276
-#define LTE 277
-#define STRING 278
-#define TYPE 279
-#define ID 280
-#define INTEGER 281
-#define BOOLEAN 282
-#define TRUE 283
-#define FALSE 284
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 33 "cool.y"
 
+#include "cool_parser.h"
 
+#line 53 "cool.tab.h"
 
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    CLASS = 258,                   /* CLASS  */
+    INHERITS = 259,                /* INHERITS  */
+    IF = 260,                      /* IF  */
+    THEN = 261,                    /* THEN  */
+    ELSE = 262,                    /* ELSE  */
+    FI = 263,                      /* FI  */
+    LET = 264,                     /* LET  */
+    IN = 265,                      /* IN  */
+    WHILE = 266,                   /* WHILE  */
+    LOOP = 267,                    /* LOOP  */
+    POOL = 268,                    /* POOL  */
+    CASE = 269,                    /* CASE  */
+    OF = 270,                      /* OF  */
+    DARROW = 271,                  /* DARROW  */
+    ESAC = 272,                    /* ESAC  */
+    NEW = 273,                     /* NEW  */
+    ISVOID = 274,                  /* ISVOID  */
+    ASSIGN = 275,                  /* ASSIGN  */
+    NOT = 276,                     /* NOT  */
+    LTE = 277,                     /* LTE  */
+    STRING = 278,                  /* STRING  */
+    TYPE = 279,                    /* TYPE  */
+    ID = 280,                      /* ID  */
+    INTEGER = 281,                 /* INTEGER  */
+    BOOLEAN = 282,                 /* BOOLEAN  */
+    TRUE = 283,                    /* TRUE  */
+    FALSE = 284                    /* FALSE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
 
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 23 "cool.y"
+union YYSTYPE
 {
+#line 44 "cool.y"
+
     class_t *class;
     class_list_t *class_list;
     feature_list_t *feature_list;
@@ -113,17 +106,36 @@ typedef union YYSTYPE
     expr_t *expr;
     expr_list_t *expr_list;
     case_list_t *case_list;
-    char *s;
+    const char *s;
+    struct { const char *ptr; size_t len; } str;
     int i;
     bool b;
-}
-/* Line 1529 of yacc.c.  */
-#line 122 "cool.tab.h"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+
+#line 115 "cool.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+#ifndef YYPUSH_MORE_DEFINED
+# define YYPUSH_MORE_DEFINED
+enum { YYPUSH_MORE = 4 };
 #endif
 
-extern YYSTYPE yylval;
+typedef struct yypstate yypstate;
+
+
+int yyparse (cool_parse_t *ctx);
+int yypush_parse (yypstate *ps,
+                  int pushed_char, YYSTYPE const *pushed_val, cool_parse_t *ctx);
+int yypull_parse (yypstate *ps, cool_parse_t *ctx);
+yypstate *yypstate_new (void);
+void yypstate_delete (yypstate *ps);
+
 
+#endif /* !YY_YY_COOL_TAB_H_INCLUDED  */
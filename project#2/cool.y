@@ -9,17 +9,38 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <limits.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
 #include "node.h"
-
-int yylex();
-extern FILE* yyin;
-extern int yylineno;
-extern char *yytext;
-static int num_errors = 0;
-static class_list_t *program;
-void yyerror(char const *s);
+#include "cool_lexer.h"
+#include "tokq.h"
+#include "parparse.h"
 %}
 
+/*
+ * 파싱 상태는 모두 문맥 ctx(cool_parser.h)에 두어 여러 스레드가 동시에 파싱할 수 있다.
+ * 스캐너에서 토큰을 당겨 오는 yyparse()와 토큰을 밀어 넣는 yypush_parse()를 함께 만든다.
+ */
+%define api.pure full
+%define api.push-pull both
+%param {cool_parse_t *ctx}
+
+%code requires {
+#include "cool_parser.h"
+}
+
+%code {
+static int yylex(YYSTYPE *lval, cool_parse_t *ctx);
+static void yyerror(cool_parse_t *ctx, char const *s);
+static void report(cool_parse_t *ctx, char const *s, int lookahead);
+static class_t *class_done(cool_parse_t *ctx, class_t *cls);
+}
+
 %union {
     class_t *class;
     class_list_t *class_list;
@@ -30,7 +51,8 @@ void yyerror(char const *s);
     expr_t *expr;
     expr_list_t *expr_list;
     case_list_t *case_list;
-    char *s;
+    const char *s;
+    struct { const char *ptr; size_t len; } str;
     int i;
     bool b;
 }
@@ -38,7 +60,8 @@ void yyerror(char const *s);
 %token CLASS INHERITS IF THEN ELSE FI LET IN
 %token WHILE LOOP POOL CASE OF DARROW ESAC
 %token NEW ISVOID ASSIGN NOT LTE
-%token <s> STRING TYPE ID
+%token <str> STRING
+%token <s> TYPE ID
 %token <i> INTEGER
 %token <b> BOOLEAN TRUE FALSE
 
@@ -56,114 +79,440 @@ void yyerror(char const *s);
 
 %%
 
-program: class_list { program = $1; }
+program: class_list { ctx->program = finish_class_list($1); }
     ;
 
-class_list: class_list class { $$ = append_class_list($1, $2); }
-          | class { $$ = create_class_list($1); }
+class_list: class_list class { $$ = append_class_list(&ctx->ast, $1, $2); }
+          | class { $$ = create_class_list(&ctx->ast, $1); }
           | error ';' {
-                yyerror("Error in class definition, skipping.");
+                report(ctx, "Error in class definition, skipping.", yychar > 0);
                 yyerrok; // 에러 복구
                 $$ = NULL;
           }
     ;
 
 class: CLASS TYPE '{' feature_list '}' ';'
-    { $$ = create_class($2, NULL, $4); }
+    { $$ = class_done(ctx, create_class(&ctx->ast, $2, NULL, finish_feature_list($4))); }
     | CLASS TYPE INHERITS TYPE '{' feature_list '}' ';'
-    { $$ = create_class($2, $4, $6); }
+    { $$ = class_done(ctx, create_class(&ctx->ast, $2, $4, finish_feature_list($6))); }
 
     ;
 
-feature_list: feature_list feature { $$ = append_feature_list($1, $2); }
+feature_list: feature_list feature { $$ = append_feature_list(&ctx->ast, $1, $2); }
             | /* empty */ { $$ = NULL; }
             ;
 
 feature: ID '(' formal_list ')' ':' TYPE '{' expr '}'
-    { $$ = create_method($1, $3, $6, $8); }
+    { $$ = create_method(&ctx->ast, $1, finish_formal_list($3), $6, $8); }
     | ID ':' TYPE
-    { $$ = create_attribute($1, $3, NULL); }
+    { $$ = create_attribute(&ctx->ast, $1, $3, NULL); }
     | ID ':' TYPE ASSIGN expr
-    { $$ = create_attribute($1, $3, $5); }
+    { $$ = create_attribute(&ctx->ast, $1, $3, $5); }
     ;
 
-formal_list: formal_list ',' formal { $$ = append_formal_list($1, $3); }
-           | formal { $$ = create_formal_list($1); }
+formal_list: formal_list ',' formal { $$ = append_formal_list(&ctx->ast, $1, $3); }
+           | formal { $$ = create_formal_list(&ctx->ast, $1); }
            | /* empty */ { $$ = NULL; }
     ;
 
-formal: ID ':' TYPE { $$ = create_formal($1, $3); }
+formal: ID ':' TYPE { $$ = create_formal(&ctx->ast, $1, $3); }
     ;
 
-expr: ID ASSIGN expr { $$ = create_assign_expr($1, $3); }
-    | IF expr THEN expr ELSE expr FI { $$ = create_if_expr($2, $4, $6); }
-    | WHILE expr LOOP expr POOL { $$ = create_while_expr($2, $4); }
-    | '{' expr_list '}' { $$ = create_block_expr($2); }
+expr: ID ASSIGN expr { $$ = create_assign_expr(&ctx->ast, $1, $3); }
+    | IF expr THEN expr ELSE expr FI { $$ = create_if_expr(&ctx->ast, $2, $4, $6); }
+    | WHILE expr LOOP expr POOL { $$ = create_while_expr(&ctx->ast, $2, $4); }
+    | '{' expr_list '}' { $$ = create_block_expr(&ctx->ast, finish_expr_list($2)); }
     | LET ID ':' TYPE IN expr
-    { $$ = create_let_expr($2, $4, NULL, $6); }
+    { $$ = create_let_expr(&ctx->ast, $2, $4, NULL, $6); }
     | LET ID ':' TYPE ASSIGN expr IN expr
-    { $$ = create_let_expr($2, $4, $6, $8); }
-    | CASE expr OF case_list ESAC { $$ = create_case_expr($2, $4); }
-    | NEW TYPE { $$ = create_new_expr($2); }
-    | ISVOID expr { $$ = create_isvoid_expr($2); }
-    | NOT expr { $$ = create_not_expr($2); }
+    { $$ = create_let_expr(&ctx->ast, $2, $4, $6, $8); }
+    | CASE expr OF case_list ESAC { $$ = create_case_expr(&ctx->ast, $2, finish_case_list($4)); }
+    | NEW TYPE { $$ = create_new_expr(&ctx->ast, $2); }
+    | ISVOID expr { $$ = create_isvoid_expr(&ctx->ast, $2); }
+    | NOT expr { $$ = create_not_expr(&ctx->ast, $2); }
     | '(' expr ')' { $$ = $2; }
-    | ID { $$ = create_object_expr($1); }
-    | INTEGER { $$ = create_int_expr($1); }
-    | STRING { $$ = create_string_expr($1); }
-    | TRUE { $$ = create_bool_expr(true); }
-    | FALSE { $$ = create_bool_expr(false); }
+    | ID { $$ = create_object_expr(&ctx->ast, $1); }
+    | INTEGER { $$ = create_int_expr(&ctx->ast, $1); }
+    | STRING { $$ = create_string_expr(&ctx->ast, $1.ptr, $1.len); }
+    | TRUE { $$ = create_bool_expr(&ctx->ast, true); }
+    | FALSE { $$ = create_bool_expr(&ctx->ast, false); }
     ;
 
-expr_list: expr_list ';' expr { $$ = append_expr_list($1, $3); }
-         | expr { $$ = create_expr_list($1); }
+expr_list: expr_list ';' expr { $$ = append_expr_list(&ctx->ast, $1, $3); }
+         | expr { $$ = create_expr_list(&ctx->ast, $1); }
          | /* empty */ { $$ = NULL; }
     ;
 
 case_list: case_list ID ':' TYPE DARROW expr ';'
-    { $$ = append_case_list($1, create_case($2, $4, $6)); }
+    { $$ = append_case_list(&ctx->ast, $1, create_case(&ctx->ast, $2, $4, $6)); }
          | ID ':' TYPE DARROW expr ';'
-    { $$ = create_case_list(create_case($1, $3, $5)); }
+    { $$ = create_case_list(&ctx->ast, create_case(&ctx->ast, $1, $3, $5)); }
     ;
 
 %%
 
-void yyerror(char const *s)
+/*
+ * 오류의 개수를 누적하고, 오류가 발생한 줄번호와 관련된 토큰을 출력한다.
+ * lookahead는 파서가 미리 읽어 둔 토큰이 있는지(입력 끝이 아닌지)이다.
+ */
+static void report(cool_parse_t *ctx, char const *s, int lookahead)
 {
-    /*
-     * 오류의 개수를 누적한다.
-     */
-    ++num_errors;
-    /*
-     * 문법 오류가 발생한 줄번호와 관련된 토큰을 출력한다.
-     */
-    if (yychar > 0)
-        printf("%s in line %d at \"%s\"\n", s, yylineno, yytext);
+    int line;
+
+    ++ctx->num_errors;
+    if (ctx->speculative)
+        return;
+    line = cool_lexer_line(ctx->lexer, ctx->token.offset);
+
+    if (lookahead)
+        printf("%s in line %d at \"%.*s\"\n", s, line, (int)ctx->token.len, ctx->token.text);
+    else
+        printf("%s in line %d (unexpected EOF)\n", s, line);
+}
+
+/* 구문 오류는 미리 읽은 토큰에서 발견되므로 마지막으로 읽은 토큰이 그 토큰이다 */
+static void yyerror(cool_parse_t *ctx, char const *s)
+{
+    report(ctx, s, ctx->token.kind > 0);
+}
+
+/* 최상위 클래스 하나를 다 읽었음을 알린다 */
+static class_t *class_done(cool_parse_t *ctx, class_t *cls)
+{
+    if (ctx->on_class)
+        ctx->on_class(ctx, cls);
+    return cls;
+}
+
+/* 토큰의 의미값을 lval에 채운다 */
+static void token_value(YYSTYPE *lval, const cool_token_t *token)
+{
+    if (token->name)
+        lval->s = token->name;
+    else if (token->kind == STRING) {
+        lval->str.ptr = token->str;
+        lval->str.len = token->str_len;
+    } else if (token->kind == INTEGER)
+        lval->i = token->value;
+}
+
+/*
+ * 파서가 다음 토큰을 요구하면 스캐너 인스턴스에서 하나를 읽어 온다.
+ * 파이프라인 모드에서는 스캐너 스레드가 큐에 넣어 둔 토큰을 꺼낸다.
+ * 식별자와 타입은 인턴된 이름을, 문자열과 정수 상수는 스캐너가 만든 내용과 값을
+ * 의미값으로 넘긴다.
+ */
+static int yylex(YYSTYPE *lval, cool_parse_t *ctx)
+{
+    if (ctx->queue)
+        tokq_pop(ctx->queue, &ctx->token);
+    else
+        cool_lexer_next(ctx->lexer, &ctx->token);
+    token_value(lval, &ctx->token);
+    return ctx->token.kind;
+}
+
+/* 문맥을 초기화한다. hugepages이면 트리의 노드를 큰 페이지로 받은 청크에 둔다(arena.h) */
+void cool_parse_init(cool_parse_t *ctx, int hugepages)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    if (hugepages)
+        arena_init_huge(&ctx->ast);
     else
-        printf("%s in line %d (unexpected EOF)\n", s, yylineno);
+        arena_init(&ctx->ast);
+}
+
+/*
+ * ctx->lexer에 열어 둔 스캐너의 입력을 파싱하여 트리를 ctx->program에 남기고 오류의
+ * 개수를 돌려준다. ctx->queue가 있으면 스캐너 대신 큐에서 토큰을 꺼낸다.
+ */
+int cool_parse(cool_parse_t *ctx)
+{
+    yyparse(ctx);
+    return ctx->num_errors;
+}
+
+/*
+ * 메모리에 있는 소스 buf를 파싱한다. 스캐너가 buf를 복사하므로 호출한 뒤 buf를 바로
+ * 다시 써도 된다. 스캐너를 만들 수 없으면 -1을 돌려준다.
+ */
+int cool_parse_buffer(cool_parse_t *ctx, const char *buf, size_t len)
+{
+    if (!(ctx->lexer = cool_lexer_open_buffer(buf, len)))
+        return -1;
+    return cool_parse(ctx);
+}
+
+/*
+ * 트리 전체와 스캐너를 돌려준다. 트리의 문자열 상수가 스캐너 버퍼를 가리키므로
+ * 트리를 다 쓴 뒤에 부른다.
+ */
+void cool_parse_release(cool_parse_t *ctx)
+{
+    arena_release(&ctx->ast);
+    if (ctx->lexer)
+        cool_lexer_close(ctx->lexer);
+    if (ctx->ps)
+        yypstate_delete(ctx->ps);
+    free(ctx->pending);
+    ctx->lexer = NULL;
+    ctx->program = NULL;
+    ctx->ps = NULL;
+    ctx->pending = NULL;
+    ctx->pending_len = ctx->pending_cap = 0;
+}
+
+/*
+ * 밀어 넣기 파싱을 시작한다. 토큰을 넘길 때는 줄번호를 구할 수 있도록 그 토큰을 만든
+ * 스캐너를 ctx->lexer에 두고 시작한다. ctx->lexer가 없으면 바이트를 받을 스캐너를 만든다.
+ * 시작할 수 없으면 -1을 돌려준다.
+ */
+int cool_push_begin(cool_parse_t *ctx)
+{
+    if (!ctx->lexer && !(ctx->lexer = cool_lexer_open_push()))
+        return -1;
+    if (!(ctx->ps = yypstate_new()))
+        return -1;
+    ctx->status = YYPUSH_MORE;
+    return 0;
+}
+
+/*
+ * 토큰 하나를 넘긴다. 토큰의 text는 다음 토큰을 넘길 때까지, str은 트리를 다 쓸 때까지
+ * 유효해야 한다. 파서가 입력을 더 받으면 0을, 입력 끝을 받았거나 복구할 수 없는 오류로
+ * 파싱이 끝났으면 1을 돌려준다. 끝난 뒤에 넘긴 토큰은 버린다.
+ */
+int cool_push_token(cool_parse_t *ctx, const cool_token_t *tok)
+{
+    YYSTYPE lval = { 0 };     /* 값이 없는 토큰(입력 끝 등)도 초기화된 값을 넘긴다 */
+
+    if (ctx->status != YYPUSH_MORE)
+        return 1;
+    ctx->token = *tok;
+    token_value(&lval, tok);
+    ctx->status = yypush_parse(ctx->ps, tok->kind, &lval, ctx);
+    return ctx->status != YYPUSH_MORE;
+}
+
+/*
+ * 줄바꿈 뒤나 입력 끝에서 끝나는 구간을 스캐너에 넘기고 그 토큰을 모두 파서에 넘긴다.
+ * 메모리가 없으면 더 진행할 수 없으므로 끝낸다.
+ */
+static void push_lines(cool_parse_t *ctx, const char *buf, size_t len)
+{
+    cool_token_t tok;
+
+    if (cool_lexer_feed(ctx->lexer, buf, len) < 0) {
+        perror("cool_parser");
+        exit(1);
+    }
+    while (ctx->status == YYPUSH_MORE && cool_lexer_next(ctx->lexer, &tok))
+        cool_push_token(ctx, &tok);
+}
+
+/* 줄이 끝나지 않은 바이트를 모아 둔다. 메모리가 없으면 더 진행할 수 없으므로 끝낸다 */
+static void keep_pending(cool_parse_t *ctx, const char *buf, size_t len)
+{
+    if (ctx->pending_len + len > ctx->pending_cap) {
+        size_t cap = ctx->pending_cap ? ctx->pending_cap : 4096;
+
+        while (cap < ctx->pending_len + len)
+            cap *= 2;
+        if (!(ctx->pending = realloc(ctx->pending, cap))) {
+            perror("cool_parser");
+            exit(1);
+        }
+        ctx->pending_cap = cap;
+    }
+    memcpy(ctx->pending + ctx->pending_len, buf, len);
+    ctx->pending_len += len;
+}
+
+/*
+ * 바이트 len개를 넘긴다. 렉심이 구간을 넘지 않도록 마지막 줄바꿈까지를 스캐너에 넘겨
+ * 그 토큰을 모두 파싱하고, 나머지는 다음 바이트와 이어 붙이도록 모아 둔다.
+ * 돌려주는 값은 cool_push_token()과 같다.
+ */
+int cool_push_bytes(cool_parse_t *ctx, const char *buf, size_t len)
+{
+    size_t n = len;
+
+    if (ctx->status != YYPUSH_MORE)
+        return 1;
+    while (n > 0 && buf[n - 1] != '\n')
+        n--;
+    if (n > 0) {
+        if (ctx->pending_len) {
+            keep_pending(ctx, buf, n);
+            push_lines(ctx, ctx->pending, ctx->pending_len);
+            ctx->pending_len = 0;
+        } else
+            push_lines(ctx, buf, n);
+    }
+    keep_pending(ctx, buf + n, len - n);
+    return ctx->status != YYPUSH_MORE;
+}
+
+/* 남은 바이트와 입력 끝을 넘겨 밀어 넣기 파싱을 끝내고 오류의 개수를 돌려준다 */
+int cool_push_end(cool_parse_t *ctx)
+{
+    cool_token_t tok = { 0 };
+
+    if (ctx->pending_len) {
+        push_lines(ctx, ctx->pending, ctx->pending_len);
+        ctx->pending_len = 0;
+    }
+    tok.offset = ctx->lexer->nextOffset;
+    tok.text = "";
+    cool_push_token(ctx, &tok);
+    yypstate_delete(ctx->ps);
+    ctx->ps = NULL;
+    return ctx->num_errors;
+}
+
+/* 스캐너 스레드. 입력 끝까지 토큰을 큐에 넣는다 */
+static void *lex_thread(void *arg)
+{
+    cool_parse_t *ctx = arg;
+    cool_token_t tok;
+
+    do {
+        cool_lexer_next(ctx->lexer, &tok);
+        tokq_push(ctx->queue, &tok);
+    } while (tok.kind != 0);
+    return NULL;
+}
+
+/*
+ * fd에서 읽히는 만큼씩 바이트를 밀어 넣어 파싱한다. 파이프로 들어오는 입력은 도착하는 대로
+ * 파싱되므로 입력이 끝나기를 기다리는 시간과 파싱 시간이 겹친다.
+ */
+static void push_input(cool_parse_t *ctx, int fd)
+{
+    static char buf[64 * 1024];
+    ssize_t n;
+
+    if (cool_push_begin(ctx) < 0) {
+        perror("cool_parser");
+        exit(1);
+    }
+    while ((n = read(fd, buf, sizeof(buf))) != 0) {
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("cool_parser");
+            exit(1);
+        }
+        if (cool_push_bytes(ctx, buf, (size_t)n))
+            break;
+    }
+    cool_push_end(ctx);
 }
 
 int main(int argc, char *argv[])
 {
+    static cool_parse_t ctx;
+    static tokq_t queue;
+    pthread_t lexer_thread;
+    int argi = 1, pipeline = 0, hugepages = 0, push = 0, parallel = 0, fd = STDIN_FILENO;
+
+    /*
+     * --pipeline은 스캐너를 별도 스레드에서 돌려 스캔과 파싱을 겹친다.
+     * --hugepages는 트리의 노드를 큰 페이지로 받은 청크에 둔다(arena.h).
+     * --push는 입력을 읽히는 대로 파서에 밀어 넣는다(cool_push_bytes).
+     * --parallel[=N]은 최상위 클래스 단위로 나누어 N개의 스레드로 파싱한다(parparse.h).
+     * N은 양의 정수이며, 없으면 온라인 CPU 수만큼 쓴다. --pipeline, --push, --parallel은
+     * 입력을 다루는 방식이 서로 달라 함께 쓸 수 없다.
+     */
+    for (; argi < argc; argi++) {
+        if (strcmp(argv[argi], "--pipeline") == 0)
+            pipeline = 1;
+        else if (strcmp(argv[argi], "--hugepages") == 0)
+            hugepages = 1;
+        else if (strcmp(argv[argi], "--push") == 0)
+            push = 1;
+        else if (strcmp(argv[argi], "--parallel") == 0)
+            parallel = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        else if (strncmp(argv[argi], "--parallel=", 11) == 0) {
+            const char *arg = argv[argi] + 11;
+            char *end;
+            long n;
+
+            /* strtol이 받는 공백, 부호와 int를 넘는 값도 거절한다 */
+            errno = 0;
+            n = strtol(arg, &end, 10);
+            if (!isdigit((unsigned char)*arg) || *end != '\0' || errno || n < 1 || n > INT_MAX) {
+                fprintf(stderr, "--parallel=N의 N은 양의 정수여야 합니다: %s\n", argv[argi]);
+                exit(1);
+            }
+            parallel = (int)n;
+        }
+        else
+            break;
+    }
+    if (pipeline + push + (parallel != 0) > 1) {
+        fprintf(stderr, "--pipeline, --push, --parallel은 함께 쓸 수 없습니다\n");
+        exit(1);
+    }
+    cool_parse_init(&ctx, hugepages);
     /*
      * 스캔할 COOL 파일을 연다. 파일명이 없으면 표준입력이 사용된다.
      */
-    if (argc > 1)
-        if (!(yyin = fopen(argv[1],"r"))) {
-            printf("\"%s\"는 잘못된 파일 경로입니다.\n", argv[1]);
+    if (push) {
+        if (argi < argc && (fd = open(argv[argi], O_RDONLY)) < 0) {
+            printf("\"%s\"는 잘못된 파일 경로입니다.\n", argv[argi]);
             exit(1);
         }
+        push_input(&ctx, fd);
+        if (fd != STDIN_FILENO)
+            close(fd);
+    } else if (argi < argc) {
+        if (!(ctx.lexer = cool_lexer_open_file(argv[argi]))) {
+            printf("\"%s\"는 잘못된 파일 경로입니다.\n", argv[argi]);
+            exit(1);
+        }
+    } else if (!(ctx.lexer = cool_lexer_open_stream(stdin))) {
+        perror("cool_parser");
+        exit(1);
+    }
+    /*
+     * 파이프라인은 파일을 버퍼로 매핑한 경우에만 쓴다. 스트림 입력은 flex가 버퍼를
+     * 다시 채우면서 큐에 남은 토큰의 렉심을 덮어쓰므로 파서가 직접 스캔한다.
+     */
+    if (pipeline && ctx.lexer->buf) {
+        tokq_init(&queue);
+        ctx.queue = &queue;
+        if (pthread_create(&lexer_thread, NULL, lex_thread, &ctx) != 0) {
+            perror("cool_parser");
+            exit(1);
+        }
+    }
     /*
      * 구문분석을 위해 수행한다.
      */
-    yyparse();
+    if (parallel)
+        cool_parse_parallel(&ctx, parallel);
+    else if (!push)
+        cool_parse(&ctx);
+    /*
+     * 파서가 입력 끝 전에 멈추었으면 스캐너 스레드가 끝날 수 있도록 남은 토큰을 비운다.
+     */
+    if (ctx.queue) {
+        while (ctx.token.kind != 0)
+            tokq_pop(ctx.queue, &ctx.token);
+        pthread_join(lexer_thread, NULL);
+    }
     /*
      * 오류의 개수를 출력한다.
      */
-    if (num_errors > 0)
-         printf("%d error(s) found\n", num_errors);
+    if (ctx.num_errors > 0)
+         printf("%d error(s) found\n", ctx.num_errors);
     else
-         show_class_list(program);
+         show_class_list(ctx.program);
+    /*
+     * 트리의 문자열 상수가 스캐너 버퍼를 가리키므로 출력이 끝난 뒤에 해제한다.
+     */
+    cool_parse_release(&ctx);
 
     return 0;
 }
\ No newline at end of file
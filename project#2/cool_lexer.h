@@ -0,0 +1,70 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ * 2022066017 응용물리학과 이규현
+ */
+
+/*
+ * 재진입 가능한 COOL 스캐너의 C 인터페이스.
+ * 줄번호 등 스캔 상태는 모두 인스턴스 안에 있으므로
+ * 서로 다른 스레드가 각자의 인스턴스로 동시에 스캔할 수 있다.
+ */
+#ifndef COOL_LEXER_H
+#define COOL_LEXER_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <pthread.h>
+#include "arena.h"
+#include "lineidx.h"
+#include "lexprof.h"
+
+/*
+ * 토큰 하나. text는 다음 cool_lexer_next() 호출 전까지만 유효하다.
+ * str은 cool_lexer_close() 전까지 유효하다.
+ */
+typedef struct cool_token {
+    int kind;
+    size_t offset;          /* 렉심의 바이트 오프셋. 줄번호는 cool_lexer_line()으로 구한다 */
+    const char *text;
+    size_t len;
+    const char *name;       /* ID와 TYPE의 인턴된 이름(intern.h), 그 밖에는 NULL */
+    const char *str;        /* STRING의 내용(큰따옴표 제외, 이스케이프 해석). '\0'으로 끝나지 않는다 */
+    size_t str_len;
+    int value;              /* INTEGER의 값 */
+} cool_token_t;
+
+/* 스캐너 인스턴스 */
+typedef struct cool_lexer {
+    void *scanner;          /* flex의 yyscan_t */
+    size_t tokenOffset;     /* 마지막으로 인식한 렉심의 바이트 오프셋 */
+    size_t nextOffset;      /* 다음 렉심이 시작할 바이트 오프셋 */
+    lineidx_t lines;        /* 줄바꿈 색인 */
+    pthread_mutex_t lines_lock; /* 파이프라인에서는 두 스레드가 줄번호를 구한다 */
+    char *buf;              /* 스캔 중인 버퍼(mmap 영역 또는 복사본) */
+    size_t buf_len;
+    int mapped;
+    FILE *fp;               /* 스트림으로 열었을 때 닫아야 할 파일 */
+    char *chunk;            /* cool_lexer_feed()로 받아 스캔 중인 구간의 복사본 */
+    const char *str;        /* 마지막 STRING의 내용 */
+    size_t str_len;
+    int value;              /* 마지막 INTEGER의 값 */
+    arena_t strings;        /* 이스케이프를 해석한 문자열 상수 */
+#ifdef COOL_LEX_PROFILE
+    lexprof_t prof;         /* 규칙별 프로파일. cool_lexer_close()가 합계에 더한다 */
+#endif
+} cool_lexer_t;
+
+/* 함수 프로토타입 선언 */
+cool_lexer_t *cool_lexer_open_buffer(const char *buf, size_t len);
+cool_lexer_t *cool_lexer_open_file(const char *path);
+cool_lexer_t *cool_lexer_open_stream(FILE *fp);
+cool_lexer_t *cool_lexer_open_push(void);
+int cool_lexer_feed(cool_lexer_t *lx, const char *buf, size_t len);
+int cool_lexer_next(cool_lexer_t *lx, cool_token_t *tok);
+int cool_lexer_line(cool_lexer_t *lx, size_t offset);
+void cool_lexer_close(cool_lexer_t *lx);
+
+#endif // COOL_LEXER_H
@@ -0,0 +1,61 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 재진입 가능한 COOL 파서의 C 인터페이스.
+ * 스캐너, 마지막 토큰, 트리의 아레나, 오류 개수 등 파싱 상태는 모두 문맥 안에 있으므로
+ * 서로 다른 스레드가 각자의 문맥으로 동시에 파싱할 수 있다. 인턴 표(intern.h)만
+ * 공유하며 이는 잠금으로 보호된다.
+ * 스캐너에서 토큰을 당겨 오는 cool_parse()와, 입력이 도착하는 대로 밀어 넣는
+ * cool_push_*()를 모두 제공한다.
+ */
+#ifndef COOL_PARSER_H
+#define COOL_PARSER_H
+
+#include <stddef.h>
+#include "node.h"
+#include "arena.h"
+#include "cool_lexer.h"
+#include "tokq.h"
+
+/* 파싱 한 번의 문맥 */
+typedef struct cool_parse {
+    cool_lexer_t *lexer;
+    cool_token_t token;         /* 마지막으로 읽은 토큰 */
+    tokq_t *queue;              /* 스캐너 스레드가 토큰을 넣는 큐. 직접 스캔하면 NULL */
+    arena_t ast;                /* 트리의 모든 노드 */
+    class_list_t *program;      /* 파싱한 트리. 오류가 있으면 일부만 있을 수 있다 */
+    int num_errors;
+    int speculative;            /* 오류를 출력하지 않고 세기만 한다(parparse.h) */
+    /* 최상위 클래스를 하나 다 읽을 때마다 부른다. NULL이면 부르지 않는다 */
+    void (*on_class)(struct cool_parse *ctx, class_t *cls);
+    void *user;                 /* on_class가 쓰는 값 */
+    /* 밀어 넣기 파싱(cool_push_*)의 상태 */
+    struct yypstate *ps;
+    int status;                 /* 마지막 yypush_parse()의 결과 */
+    char *pending;              /* 아직 줄이 끝나지 않아 스캐너에 넘기지 않은 바이트 */
+    size_t pending_len;
+    size_t pending_cap;
+} cool_parse_t;
+
+/* 함수 프로토타입 선언 */
+void cool_parse_init(cool_parse_t *ctx, int hugepages);
+int cool_parse(cool_parse_t *ctx);
+int cool_parse_buffer(cool_parse_t *ctx, const char *buf, size_t len);
+void cool_parse_release(cool_parse_t *ctx);
+
+/*
+ * 밀어 넣기 파싱. 입력 전체를 기다리지 않고 토큰이나 바이트를 도착하는 대로 넘긴다.
+ * cool_push_begin()으로 시작하여 cool_push_token() 또는 cool_push_bytes()를 되풀이해
+ * 부르고 cool_push_end()로 끝낸다. 두 넘기기 함수를 섞어 쓰지는 않는다.
+ */
+int cool_push_begin(cool_parse_t *ctx);
+int cool_push_token(cool_parse_t *ctx, const cool_token_t *tok);
+int cool_push_bytes(cool_parse_t *ctx, const char *buf, size_t len);
+int cool_push_end(cool_parse_t *ctx);
+
+#endif // COOL_PARSER_H
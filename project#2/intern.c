@@ -0,0 +1,110 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#include "intern.h"
+#include "arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#define INIT_SLOTS  256             /* 해시 표의 처음 칸 수(2의 거듭제곱) */
+
+/* 해시 표의 칸. str이 NULL이면 빈 칸이다 */
+typedef struct slot {
+    const char *str;
+    uint32_t hash;
+    uint32_t len;
+} slot_t;
+
+static slot_t *slots;
+static size_t nslots;
+static size_t count;
+static arena_t strings;         /* 인턴된 문자열의 저장 영역. 해제하지 않는다 */
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;   /* 여러 파서가 함께 쓴다 */
+
+/* 메모리를 잡을 수 없으면 더 진행할 수 없으므로 끝낸다 */
+static void *xmalloc(size_t size)
+{
+    void *p = malloc(size);
+
+    if (!p) {
+        perror("intern");
+        exit(1);
+    }
+    return p;
+}
+
+/* FNV-1a */
+static uint32_t hash(const char *s, size_t len)
+{
+    uint32_t h = 2166136261u;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        h ^= (unsigned char)s[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* 저장 영역에 len 바이트와 '\0'을 복사하여 그 주소를 돌려준다 */
+static const char *store(const char *s, size_t len)
+{
+    char *p = arena_bytes(&strings, len + 1);
+
+    memcpy(p, s, len);
+    p[len] = '\0';
+    return p;
+}
+
+/* 칸 수를 두 배로 늘리고 모든 항목을 다시 넣는다 */
+static void grow(void)
+{
+    size_t n = nslots ? nslots * 2 : INIT_SLOTS;
+    slot_t *t = xmalloc(sizeof(slot_t) * n);
+    size_t i, j;
+
+    memset(t, 0, sizeof(slot_t) * n);
+    for (i = 0; i < nslots; i++) {
+        if (!slots[i].str)
+            continue;
+        for (j = slots[i].hash & (n - 1); t[j].str; j = (j + 1) & (n - 1))
+            ;
+        t[j] = slots[i];
+    }
+    free(slots);
+    slots = t;
+    nslots = n;
+}
+
+/*
+ * s부터 len 바이트의 철자에 해당하는 유일한 문자열을 돌려준다.
+ * 처음 보는 철자이면 저장 영역에 복사하여 표에 넣는다. 돌려준 문자열은 '\0'으로 끝난다.
+ */
+const char *intern(const char *s, size_t len)
+{
+    uint32_t h = hash(s, len);
+    const char *p;
+    size_t i;
+
+    pthread_mutex_lock(&lock);
+    if (count * 2 >= nslots)
+        grow();
+    for (i = h & (nslots - 1); slots[i].str; i = (i + 1) & (nslots - 1))
+        if (slots[i].hash == h && slots[i].len == len && memcmp(slots[i].str, s, len) == 0)
+            break;
+    if (!slots[i].str) {
+        slots[i].str = store(s, len);
+        slots[i].hash = h;
+        slots[i].len = (uint32_t)len;
+        count++;
+    }
+    p = slots[i].str;
+    pthread_mutex_unlock(&lock);
+    return p;
+}
@@ -0,0 +1,22 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 식별자와 타입 이름의 인턴 표.
+ * 같은 철자는 항상 같은 포인터로 돌려주므로 이름끼리는 ==로 비교할 수 있다.
+ * 문자열은 아레나(arena.h)에 이어 붙여 두며 프로그램이 끝날 때까지 유지된다.
+ * 표는 프로세스 전체에서 하나이며 잠금으로 보호하므로 여러 스레드가 동시에 부를 수 있다.
+ */
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <stddef.h>
+
+/* 함수 프로토타입 선언 */
+const char *intern(const char *s, size_t len);
+
+#endif // INTERN_H
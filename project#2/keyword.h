@@ -0,0 +1,119 @@
+/* kwgen이 생성한 파일이다. 직접 수정하지 말고 kwgen.c를 고친다. */
+#ifndef KEYWORD_H
+#define KEYWORD_H
+
+#include <string.h>
+#include <strings.h>
+
+#define KW_MIN_LEN 2
+#define KW_MAX_LEN 8
+
+static const unsigned char kw_asso[3][26] = {
+    { 56,47,12, 3,58, 5,31,17,60, 8,25,22,59,57,21,57,61,20, 8,16,29,41,37,29,23,60 },
+    { 19,11,18,28,15,39,48, 4,33,30,24,51, 0,58,62,11, 4,28,55,43,16,56,62,14,59,19 },
+    {  5,32, 3,62,61,36,48,15,36, 7,10,36,18, 1,58,23, 1,49, 0, 0,31,53,26,45,21,12 },
+};
+
+static const struct {
+    const char *name;
+    unsigned char len;
+    int token;
+    int anycase;
+    const char *alt[2];
+} kw_table[64] = {
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "class", 5, CLASS, 1, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "if", 2, IF, 0, { "If" } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "fi", 2, FI, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "then", 4, THEN, 0, { NULL } },
+    { "false", 5, FALSE, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "pool", 4, POOL, 0, { NULL } },
+    { "case", 4, CASE, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "of", 2, OF, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "new", 3, NEW, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "let", 3, LET, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "while", 5, WHILE, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "true", 4, TRUE, 0, { NULL } },
+    { "else", 4, ELSE, 0, { "ELSE" } },
+    { "loop", 4, LOOP, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "isvoid", 6, ISVOID, 0, { NULL } },
+    { "esac", 4, ESAC, 0, { NULL } },
+    { "in", 2, IN, 0, { NULL } },
+    { "not", 3, NOT, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+    { "inherits", 8, INHERITS, 1, { NULL } },
+    { NULL, 0, 0, 0, { NULL } },
+};
+
+/*
+ * 렉심이 예약어이면 그 토큰을, 아니면 0을 돌려준다.
+ * 해시 계산에는 대소문자를 무시하지만, 비교는 허용된 철자와 정확히 맞아야 한다.
+ */
+static int keyword_lookup(const char *s, size_t len)
+{
+    unsigned int c0, c1, cn, h;
+    int i;
+
+    if (len < KW_MIN_LEN || len > KW_MAX_LEN)
+        return 0;
+    c0 = (unsigned char)(s[0] | 0x20) - 'a';
+    c1 = (unsigned char)(s[1] | 0x20) - 'a';
+    cn = (unsigned char)(s[len - 1] | 0x20) - 'a';
+    if (c0 >= 26 || c1 >= 26 || cn >= 26)
+        return 0;
+    h = (unsigned int)(len + kw_asso[0][c0] + kw_asso[1][c1] + kw_asso[2][cn]) % 64;
+    if (kw_table[h].len != len)
+        return 0;
+    if (memcmp(s, kw_table[h].name, len) == 0)
+        return kw_table[h].token;
+    if (kw_table[h].anycase)
+        return strncasecmp(s, kw_table[h].name, len) == 0 ? kw_table[h].token : 0;
+    for (i = 0; i < 2 && kw_table[h].alt[i]; i++)
+        if (memcmp(s, kw_table[h].alt[i], len) == 0)
+            return kw_table[h].token;
+    return 0;
+}
+
+#endif // KEYWORD_H
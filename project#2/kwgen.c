@@ -0,0 +1,157 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ * 2022066017 응용물리학과 이규현
+ */
+
+/*
+ * COOL 예약어의 완전 해시 표(keyword.h)를 생성한다.
+ *
+ * 해시는 길이와 첫 글자, 둘째 글자, 마지막 글자를 소문자로 바꾼 값의
+ * 연관값(asso) 합이며, 예약어끼리 충돌하지 않는 연관값을 빌드할 때 찾는다.
+ * 조회 함수는 해시로 찾은 한 칸과 렉심을 비교하여 허용된 철자일 때만 토큰을 돌려준다.
+ * 허용된 철자는 소문자 철자와 alt에 나열한 철자이며, anycase이면 대소문자를 가리지 않는다.
+ *
+ *   사용법: ./kwgen > keyword.h
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TABLE_SIZE  64
+#define MAX_ALT     2
+
+/* 예약어와 토큰 이름, 대소문자 무시 여부, 소문자 외에 허용하는 철자 */
+static const struct {
+    const char *name;
+    const char *token;
+    int anycase;
+    const char *alt[MAX_ALT];
+} keywords[] = {
+    { "class",    "CLASS",    1, { NULL } },
+    { "inherits", "INHERITS", 1, { NULL } },
+    { "if",       "IF",       0, { "If", NULL } },
+    { "then",     "THEN",     0, { NULL } },
+    { "else",     "ELSE",     0, { "ELSE", NULL } },
+    { "fi",       "FI",       0, { NULL } },
+    { "while",    "WHILE",    0, { NULL } },
+    { "loop",     "LOOP",     0, { NULL } },
+    { "pool",     "POOL",     0, { NULL } },
+    { "let",      "LET",      0, { NULL } },
+    { "in",       "IN",       0, { NULL } },
+    { "case",     "CASE",     0, { NULL } },
+    { "of",       "OF",       0, { NULL } },
+    { "esac",     "ESAC",     0, { NULL } },
+    { "new",      "NEW",      0, { NULL } },
+    { "isvoid",   "ISVOID",   0, { NULL } },
+    { "not",      "NOT",      0, { NULL } },
+    { "true",     "TRUE",     0, { NULL } },
+    { "false",    "FALSE",    0, { NULL } },
+};
+#define NKEYWORDS ((int)(sizeof(keywords) / sizeof(keywords[0])))
+
+static unsigned char asso[3][26];
+
+static unsigned int hash(const char *s, size_t len)
+{
+    return (unsigned int)(len + asso[0][s[0] - 'a'] + asso[1][s[1] - 'a']
+                          + asso[2][s[len - 1] - 'a']) % TABLE_SIZE;
+}
+
+/* 충돌이 없는 연관값을 찾는다. 같은 결과가 나오도록 난수열은 고정한다 */
+static int search(int *slot)
+{
+    unsigned int seed = 1;
+    int tries, i, j, k;
+
+    for (tries = 0; tries < 1000000; tries++) {
+        int used[TABLE_SIZE] = { 0 };
+        for (i = 0; i < 3; i++)
+            for (j = 0; j < 26; j++) {
+                seed = seed * 1103515245u + 12345u;
+                asso[i][j] = (unsigned char)((seed >> 16) % TABLE_SIZE);
+            }
+        for (k = 0; k < NKEYWORDS; k++) {
+            slot[k] = (int)hash(keywords[k].name, strlen(keywords[k].name));
+            if (used[slot[k]])
+                break;
+            used[slot[k]] = 1;
+        }
+        if (k == NKEYWORDS)
+            return 0;
+    }
+    return -1;
+}
+
+int main(void)
+{
+    int slot[NKEYWORDS];
+    int entry[TABLE_SIZE];
+    size_t minLen = 255, maxLen = 0, len;
+    int i, j, k;
+
+    if (search(slot) < 0) {
+        fprintf(stderr, "kwgen: 완전 해시를 찾지 못했습니다\n");
+        return 1;
+    }
+    for (i = 0; i < TABLE_SIZE; i++)
+        entry[i] = -1;
+    for (k = 0; k < NKEYWORDS; k++) {
+        entry[slot[k]] = k;
+        len = strlen(keywords[k].name);
+        if (len < minLen) minLen = len;
+        if (len > maxLen) maxLen = len;
+    }
+
+    printf("/* kwgen이 생성한 파일이다. 직접 수정하지 말고 kwgen.c를 고친다. */\n");
+    printf("#ifndef KEYWORD_H\n#define KEYWORD_H\n\n");
+    printf("#include <string.h>\n#include <strings.h>\n\n");
+    printf("#define KW_MIN_LEN %zu\n#define KW_MAX_LEN %zu\n\n", minLen, maxLen);
+    printf("static const unsigned char kw_asso[3][26] = {\n");
+    for (i = 0; i < 3; i++) {
+        printf("    {");
+        for (j = 0; j < 26; j++)
+            printf("%s%2d", j ? "," : " ", asso[i][j]);
+        printf(" },\n");
+    }
+    printf("};\n\n");
+    printf("static const struct {\n    const char *name;\n    unsigned char len;\n"
+           "    int token;\n    int anycase;\n    const char *alt[%d];\n} kw_table[%d] = {\n", MAX_ALT, TABLE_SIZE);
+    for (i = 0; i < TABLE_SIZE; i++) {
+        if (entry[i] < 0) {
+            printf("    { NULL, 0, 0, 0, { NULL } },\n");
+            continue;
+        }
+        k = entry[i];
+        printf("    { \"%s\", %zu, %s, %d, {", keywords[k].name, strlen(keywords[k].name),
+               keywords[k].token, keywords[k].anycase);
+        for (j = 0; j < MAX_ALT && keywords[k].alt[j]; j++)
+            printf("%s\"%s\"", j ? ", " : " ", keywords[k].alt[j]);
+        printf("%s } },\n", j ? "" : " NULL");
+    }
+    printf("};\n\n");
+    printf("/*\n"
+           " * 렉심이 예약어이면 그 토큰을, 아니면 0을 돌려준다.\n"
+           " * 해시 계산에는 대소문자를 무시하지만, 비교는 허용된 철자와 정확히 맞아야 한다.\n"
+           " */\n");
+    printf("static int keyword_lookup(const char *s, size_t len)\n{\n"
+           "    unsigned int c0, c1, cn, h;\n    int i;\n\n"
+           "    if (len < KW_MIN_LEN || len > KW_MAX_LEN)\n        return 0;\n"
+           "    c0 = (unsigned char)(s[0] | 0x20) - 'a';\n"
+           "    c1 = (unsigned char)(s[1] | 0x20) - 'a';\n"
+           "    cn = (unsigned char)(s[len - 1] | 0x20) - 'a';\n"
+           "    if (c0 >= 26 || c1 >= 26 || cn >= 26)\n        return 0;\n"
+           "    h = (unsigned int)(len + kw_asso[0][c0] + kw_asso[1][c1] + kw_asso[2][cn]) %% %d;\n"
+           "    if (kw_table[h].len != len)\n        return 0;\n"
+           "    if (memcmp(s, kw_table[h].name, len) == 0)\n        return kw_table[h].token;\n"
+           "    if (kw_table[h].anycase)\n"
+           "        return strncasecmp(s, kw_table[h].name, len) == 0 ? kw_table[h].token : 0;\n"
+           "    for (i = 0; i < %d && kw_table[h].alt[i]; i++)\n"
+           "        if (memcmp(s, kw_table[h].alt[i], len) == 0)\n"
+           "            return kw_table[h].token;\n"
+           "    return 0;\n}\n\n", TABLE_SIZE, MAX_ALT);
+    printf("#endif // KEYWORD_H\n");
+    return 0;
+}
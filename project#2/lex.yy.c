@@ -1,9 +1,7 @@
 
-#line 2 "lex.yy.c"
-
 #define  YY_INT_ALIGNED short int
 
-/* A lexical scanner generated by flex */
+/* A lexical scanner generated by flex (flexemu stand-in, 2.6.4 skeleton) */
 
 #define FLEX_SCANNER
 #define YY_FLEX_MAJOR_VERSION 2
@@ -13,32 +11,13 @@
 #define FLEX_BETA
 #endif
 
-/* First, we deal with  platform-specific or compiler-specific issues. */
-
-/* begin standard C headers. */
 #include <stdio.h>
 #include <string.h>
 #include <errno.h>
 #include <stdlib.h>
 
-/* end standard C headers. */
-
-/* flex integer type definitions */
-
 #ifndef FLEXINT_H
 #define FLEXINT_H
-
-/* C99 systems have <inttypes.h>. Non-C99 systems may or may not. */
-
-#if defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
-
-/* C99 says to define __STDC_LIMIT_MACROS before including stdint.h,
- * if you want the limit (max/min) macros for int types. 
- */
-#ifndef __STDC_LIMIT_MACROS
-#define __STDC_LIMIT_MACROS 1
-#endif
-
 #include <inttypes.h>
 typedef int8_t flex_int8_t;
 typedef uint8_t flex_uint8_t;
@@ -46,55 +25,8 @@ typedef int16_t flex_int16_t;
 typedef uint16_t flex_uint16_t;
 typedef int32_t flex_int32_t;
 typedef uint32_t flex_uint32_t;
-typedef uint64_t flex_uint64_t;
-#else
-typedef signed char flex_int8_t;
-typedef short int flex_int16_t;
-typedef int flex_int32_t;
-typedef unsigned char flex_uint8_t; 
-typedef unsigned short int flex_uint16_t;
-typedef unsigned int flex_uint32_t;
-
-/* Limits of integral types. */
-#ifndef INT8_MIN
-#define INT8_MIN               (-128)
-#endif
-#ifndef INT16_MIN
-#define INT16_MIN              (-32767-1)
-#endif
-#ifndef INT32_MIN
-#define INT32_MIN              (-2147483647-1)
-#endif
-#ifndef INT8_MAX
-#define INT8_MAX               (127)
-#endif
-#ifndef INT16_MAX
-#define INT16_MAX              (32767)
-#endif
-#ifndef INT32_MAX
-#define INT32_MAX              (2147483647)
-#endif
-#ifndef UINT8_MAX
-#define UINT8_MAX              (255U)
-#endif
-#ifndef UINT16_MAX
-#define UINT16_MAX             (65535U)
-#endif
-#ifndef UINT32_MAX
-#define UINT32_MAX             (4294967295U)
-#endif
-
-#ifndef SIZE_MAX
-#define SIZE_MAX               (~(size_t)0)
-#endif
-
-#endif /* ! C99 */
-
 #endif /* ! FLEXINT_H */
 
-/* begin standard C++ headers. */
-
-/* TODO: this is always defined, so inline it */
 #define yyconst const
 
 #if defined(__GNUC__) && __GNUC__ >= 3
@@ -103,46 +35,35 @@ typedef unsigned int flex_uint32_t;
 #define yynoreturn
 #endif
 
-/* Returned upon end-of-file. */
 #define YY_NULL 0
 
-/* Promotes a possibly negative, possibly signed char to an
- *   integer in range [0..255] for use as an array index.
- */
 #define YY_SC_TO_UI(c) ((YY_CHAR) (c))
 
-/* Enter a start condition.  This macro really ought to take a parameter,
- * but we do it the disgusting crufty way forced on us by the ()-less
- * definition of BEGIN.
- */
-#define BEGIN (yy_start) = 1 + 2 *
-/* Translate the current start state into a value that can be later handed
- * to BEGIN to return to the state.  The YYSTATE alias is for lex
- * compatibility.
- */
-#define YY_START (((yy_start) - 1) / 2)
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+
+#define yyin yyg->yyin_r
+#define yyout yyg->yyout_r
+#define yyextra yyg->yyextra_r
+#define yyleng yyg->yyleng_r
+#define yytext yyg->yytext_r
+#define yylineno (YY_CURRENT_BUFFER_LVALUE->yy_bs_lineno)
+#define yycolumn (YY_CURRENT_BUFFER_LVALUE->yy_bs_column)
+#define yy_flex_debug yyg->yy_flex_debug_r
+
+#define BEGIN yyg->yy_start = 1 + 2 *
+#define YY_START ((yyg->yy_start - 1) / 2)
 #define YYSTATE YY_START
-/* Action number for EOF rule of a given start state. */
 #define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
-/* Special action meaning "start processing a new file". */
-#define YY_NEW_FILE yyrestart( yyin  )
+#define YY_NEW_FILE yyrestart( yyin , yyscanner )
 #define YY_END_OF_BUFFER_CHAR 0
 
-/* Size of default input buffer. */
 #ifndef YY_BUF_SIZE
-#ifdef __ia64__
-/* On IA-64, the buffer size is 16k, not 8k.
- * Moreover, YY_BUF_SIZE is 2*YY_READ_BUF_SIZE in the general case.
- * Ditto for the __ia64__ case accordingly.
- */
-#define YY_BUF_SIZE 32768
-#else
 #define YY_BUF_SIZE 16384
-#endif /* __ia64__ */
 #endif
 
-/* The state buf must be large enough to hold one state per character in the main buffer.
- */
 #define YY_STATE_BUF_SIZE   ((YY_BUF_SIZE + 2) * sizeof(yy_state_type))
 
 #ifndef YY_TYPEDEF_YY_BUFFER_STATE
@@ -155,415 +76,200 @@ typedef struct yy_buffer_state *YY_BUFFER_STATE;
 typedef size_t yy_size_t;
 #endif
 
-extern yy_size_t yyleng;
-
-extern FILE *yyin, *yyout;
-
 #define EOB_ACT_CONTINUE_SCAN 0
 #define EOB_ACT_END_OF_FILE 1
 #define EOB_ACT_LAST_MATCH 2
-    
-    /* Note: We specifically omit the test for yy_rule_can_match_eol because it requires
-     *       access to the local variable yy_act. Since yyless() is a macro, it would break
-     *       existing scanners that call yyless() from OUTSIDE yylex.
-     *       One obvious solution it to make yy_act a global. I tried that, and saw
-     *       a 5% performance hit in a non-yylineno scanner, because yy_act is
-     *       normally declared as a register variable-- so it is not worth it.
-     */
-    #define  YY_LESS_LINENO(n) \
-            do { \
-                yy_size_t yyl;\
-                for ( yyl = n; yyl < yyleng; ++yyl )\
-                    if ( yytext[yyl] == '\n' )\
-                        --yylineno;\
-            }while(0)
-    #define YY_LINENO_REWIND_TO(dst) \
-            do {\
-                const char *p;\
-                for ( p = yy_cp-1; p >= (dst); --p)\
-                    if ( *p == '\n' )\
-                        --yylineno;\
-            }while(0)
-    
-/* Return all but the first "n" matched characters back to the input stream. */
+
+    #define YY_LESS_LINENO(n)
+    #define YY_LINENO_REWIND_TO(ptr)
+
 #define yyless(n) \
 	do \
 		{ \
-		/* Undo effects of setting up yytext. */ \
         int yyless_macro_arg = (n); \
         YY_LESS_LINENO(yyless_macro_arg);\
-		*yy_cp = (yy_hold_char); \
+		*yy_cp = yyg->yy_hold_char; \
 		YY_RESTORE_YY_MORE_OFFSET \
-		(yy_c_buf_p) = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
+		yyg->yy_c_buf_p = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
 		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
 		} \
 	while ( 0 )
-#define unput(c) yyunput( c, (yytext_ptr)  )
+#define unput(c) yyunput( c, yyg->yytext_ptr , yyscanner )
 
 #ifndef YY_STRUCT_YY_BUFFER_STATE
 #define YY_STRUCT_YY_BUFFER_STATE
 struct yy_buffer_state
 	{
 	FILE *yy_input_file;
-
 	char *yy_ch_buf;		/* input buffer */
 	char *yy_buf_pos;		/* current position in input buffer */
-
-	/* Size of input buffer in bytes, not including room for EOB
-	 * characters.
-	 */
 	int yy_buf_size;
-
-	/* Number of characters read into yy_ch_buf, not including EOB
-	 * characters.
-	 */
-	yy_size_t yy_n_chars;
-
-	/* Whether we "own" the buffer - i.e., we know we created it,
-	 * and can realloc() it to grow it, and should free() it to
-	 * delete it.
-	 */
+	int yy_n_chars;
 	int yy_is_our_buffer;
-
-	/* Whether this is an "interactive" input source; if so, and
-	 * if we're using stdio for input, then we want to use getc()
-	 * instead of fread(), to make sure we stop fetching input after
-	 * each newline.
-	 */
 	int yy_is_interactive;
-
-	/* Whether we're considered to be at the beginning of a line.
-	 * If so, '^' rules will be active on the next match, otherwise
-	 * not.
-	 */
 	int yy_at_bol;
-
     int yy_bs_lineno; /**< The line count. */
     int yy_bs_column; /**< The column count. */
-
-	/* Whether to try to fill the input buffer when we reach the
-	 * end of it.
-	 */
 	int yy_fill_buffer;
-
 	int yy_buffer_status;
-
 #define YY_BUFFER_NEW 0
 #define YY_BUFFER_NORMAL 1
-	/* When an EOF's been seen but there's still some text to process
-	 * then we mark the buffer as YY_EOF_PENDING, to indicate that we
-	 * shouldn't try reading from the input source any more.  We might
-	 * still have a bunch of tokens to match, though, because of
-	 * possible backing-up.
-	 *
-	 * When we actually see the EOF, we change the status to "new"
-	 * (via yyrestart()), so that the user can continue scanning by
-	 * just pointing yyin at a new input file.
-	 */
 #define YY_BUFFER_EOF_PENDING 2
-
 	};
 #endif /* !YY_STRUCT_YY_BUFFER_STATE */
 
-/* Stack of input buffers. */
-static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
-static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
-static YY_BUFFER_STATE * yy_buffer_stack = NULL; /**< Stack as an array. */
-
-/* We provide macros for accessing buffer states in case in the
- * future we want to put the buffer states in a more general
- * "scanner state".
- *
- * Returns the top of the stack, or NULL.
- */
-#define YY_CURRENT_BUFFER ( (yy_buffer_stack) \
-                          ? (yy_buffer_stack)[(yy_buffer_stack_top)] \
+#define YY_CURRENT_BUFFER ( yyg->yy_buffer_stack \
+                          ? yyg->yy_buffer_stack[yyg->yy_buffer_stack_top] \
                           : NULL)
-/* Same as previous macro, but useful when we know that the buffer stack is not
- * NULL or when we need an lvalue. For internal use only.
- */
-#define YY_CURRENT_BUFFER_LVALUE (yy_buffer_stack)[(yy_buffer_stack_top)]
-
-/* yy_hold_char holds the character lost when yytext is formed. */
-static char yy_hold_char;
-static yy_size_t yy_n_chars;		/* number of characters read into yy_ch_buf */
-yy_size_t yyleng;
-
-/* Points to current character in buffer. */
-static char *yy_c_buf_p = NULL;
-static int yy_init = 0;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
-
-/* Flag which is used to allow yywrap()'s to do buffer switches
- * instead of setting up a fresh yyin.  A bit of a hack ...
- */
-static int yy_did_buffer_switch_on_eof;
-
-void yyrestart ( FILE *input_file  );
-void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer  );
-YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size  );
-void yy_delete_buffer ( YY_BUFFER_STATE b  );
-void yy_flush_buffer ( YY_BUFFER_STATE b  );
-void yypush_buffer_state ( YY_BUFFER_STATE new_buffer  );
-void yypop_buffer_state ( void );
-
-static void yyensure_buffer_stack ( void );
-static void yy_load_buffer_state ( void );
-static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file  );
-#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER )
-
-YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size  );
-YY_BUFFER_STATE yy_scan_string ( const char *yy_str  );
-YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, yy_size_t len  );
-
-void *yyalloc ( yy_size_t  );
-void *yyrealloc ( void *, yy_size_t  );
-void yyfree ( void *  );
-
-#define yy_new_buffer yy_create_buffer
-#define yy_set_interactive(is_interactive) \
-	{ \
-	if ( ! YY_CURRENT_BUFFER ){ \
-        yyensure_buffer_stack (); \
-		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer( yyin, YY_BUF_SIZE ); \
-	} \
-	YY_CURRENT_BUFFER_LVALUE->yy_is_interactive = is_interactive; \
-	}
-#define yy_set_bol(at_bol) \
-	{ \
-	if ( ! YY_CURRENT_BUFFER ){\
-        yyensure_buffer_stack (); \
-		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer( yyin, YY_BUF_SIZE ); \
-	} \
-	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; \
-	}
-#define YY_AT_BOL() (YY_CURRENT_BUFFER_LVALUE->yy_at_bol)
-
-/* Begin user sect3 */
+#define YY_CURRENT_BUFFER_LVALUE yyg->yy_buffer_stack[yyg->yy_buffer_stack_top]
+
+void yyrestart ( FILE *input_file , yyscan_t yyscanner );
+void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size , yyscan_t yyscanner );
+void yy_delete_buffer ( YY_BUFFER_STATE b , yyscan_t yyscanner );
+void yy_flush_buffer ( YY_BUFFER_STATE b , yyscan_t yyscanner );
+void yypush_buffer_state ( YY_BUFFER_STATE new_buffer , yyscan_t yyscanner );
+void yypop_buffer_state ( yyscan_t yyscanner );
+
+static void yyensure_buffer_stack ( yyscan_t yyscanner );
+static void yy_load_buffer_state ( yyscan_t yyscanner );
+static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file , yyscan_t yyscanner );
+#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER , yyscanner)
+
+YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_scan_string ( const char *yy_str , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, int len , yyscan_t yyscanner );
+
+void *yyalloc ( yy_size_t , yyscan_t yyscanner );
+void *yyrealloc ( void *, yy_size_t , yyscan_t yyscanner );
+void yyfree ( void * , yyscan_t yyscanner );
+
+#define yywrap(yyscanner) (/*CONSTCOND*/1)
+#define YY_SKIP_YYWRAP
 typedef flex_uint8_t YY_CHAR;
 
-FILE *yyin = NULL, *yyout = NULL;
-
 typedef int yy_state_type;
 
-extern int yylineno;
-int yylineno = 1;
-
-extern char *yytext;
-#ifdef yytext_ptr
-#undef yytext_ptr
-#endif
-#define yytext_ptr yytext
+#define yytext_ptr yytext_r
 
-static yy_state_type yy_get_previous_state ( void );
-static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  );
-static int yy_get_next_buffer ( void );
-static void yynoreturn yy_fatal_error ( const char* msg  );
+static yy_state_type yy_get_previous_state ( yyscan_t yyscanner );
+static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  , yyscan_t yyscanner);
+static int yy_get_next_buffer ( yyscan_t yyscanner );
+static void yynoreturn yy_fatal_error ( const char* msg , yyscan_t yyscanner );
 
-/* Done after the current pattern has been matched and before the
- * corresponding action - sets up yytext.
- */
 #define YY_DO_BEFORE_ACTION \
-	(yytext_ptr) = yy_bp; \
-	yyleng = (yy_size_t) (yy_cp - yy_bp); \
-	(yy_hold_char) = *yy_cp; \
+	yyg->yytext_ptr = yy_bp; \
+	yyleng = (int) (yy_cp - yy_bp); \
+	yyg->yy_hold_char = *yy_cp; \
 	*yy_cp = '\0'; \
-	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 53
-#define YY_END_OF_BUFFER 54
-/* This struct is not used in this scanner,
-   but its presence is necessary. */
-struct yy_trans_info
-	{
-	flex_int32_t yy_verify;
-	flex_int32_t yy_nxt;
-	};
-static const flex_int16_t yy_accept[136] =
-    {   0,
-        0,    0,    0,    0,    0,    0,   54,   52,    5,    6,
-       52,   52,   33,   34,   48,   46,   42,   47,   45,   49,
-       31,   44,   43,   39,   41,   51,   29,   29,   29,   29,
-       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
-       30,   35,   36,   50,    3,    4,    3,   53,    5,    6,
-        0,   32,    0,    1,    0,   31,   38,   37,   40,   29,
-       29,   29,   29,   10,   30,   30,   30,   30,   30,   30,
-       15,   30,   11,   20,   30,   30,   30,   30,   30,   22,
-       30,   30,   30,   30,    2,    0,    7,   29,   29,   29,
-       30,   30,   30,   30,   30,   30,   30,   19,   30,   24,
-
-       28,   30,   30,   30,   30,   29,   13,   29,   30,   21,
-       14,   23,   30,   30,   30,   17,   18,   12,   26,   30,
-        8,   29,    8,   27,   30,   30,   16,   29,   30,   25,
-       29,   30,    9,    9,    0
+	yyg->yy_c_buf_p = yy_cp;
+
+#define YY_NUM_RULES 34
+#define YY_END_OF_BUFFER 35
+#define YY_JAM_STATE 53
+#define YY_NUL_EC 1
+#define YY_NUM_EC 28
+static const flex_int16_t yy_accept[54] =
+    {
+            0,     0,     0,     0,     0,     0,     0,    33,     6,     6,
+           33,    13,    14,    15,    29,    27,    23,    28,    26,    30,
+           11,    25,    24,    20,    22,    32,     9,    10,    16,    17,
+           31,     3,     5,     4,    34,     6,     7,    13,    12,    13,
+            1,     8,    11,    19,    18,    21,     9,    10,     3,     2,
+           13,     8,    35,     0
     } ;
-
 static const YY_CHAR yy_ec[256] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    1,    5,    1,    1,    1,    1,    1,    6,
-        7,    8,    9,   10,   11,   12,   13,   14,   14,   14,
-       14,   14,   14,   14,   14,   14,   14,   15,   16,   17,
-       18,   19,    1,   20,   21,   22,   23,   22,   24,   22,
-       22,   25,   26,   22,   22,   27,   22,   28,   22,   22,
-       22,   29,   30,   31,   22,   22,   22,   22,   22,   22,
-        1,   32,    1,    1,   33,    1,   34,   35,   36,   37,
-
-       38,   39,   33,   40,   41,   33,   33,   42,   33,   43,
-       44,   45,   33,   46,   47,   48,   49,   50,   51,   33,
-       33,   33,   52,    1,   53,   54,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
-    } ;
-
-static const YY_CHAR yy_meta[55] =
-    {   0,
-        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    3,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    1,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    1,    1,    1
-    } ;
-
-static const flex_int16_t yy_base[142] =
-    {   0,
-        0,    0,   52,   53,    0,    0,  188,  189,  185,  189,
-      183,   52,  177,  189,  189,  189,  189,  173,  189,  189,
-      169,  189,  189,   47,  163,  189,    0,   32,  154,   34,
-        0,   36,   22,   34,   43,   28,   41,  141,  135,   41,
-      138,  189,  189,  189,  189,  189,  170,  189,  174,  189,
-       62,  189,   71,  189,  172,  160,  189,  189,  189,    0,
-       59,  143,   58,    0,    0,   67,  125,  124,  136,  127,
-        0,   64,    0,   67,  118,  119,  122,  114,  116,    0,
-      119,  124,  112,  119,  189,  156,  189,   61,  134,   71,
-       66,  119,  118,  119,  107,   73,  105,    0,   94,    0,
-
-        0,   94,   92,   96,   90,   69,    0,   71,   75,    0,
-        0,    0,   93,   83,   87,    0,    0,    0,    0,   89,
-        0,   89,    0,    0,   92,   89,    0,   89,   90,    0,
-       93,   94,    0,    0,  189,  141,  144,  147,  122,   99,
-      150
-    } ;
-
-static const flex_int16_t yy_def[142] =
-    {   0,
-      135,    1,  136,  136,  137,  137,  135,  135,  135,  135,
-      135,  138,  135,  135,  135,  135,  135,  135,  135,  135,
-      135,  135,  135,  135,  135,  135,  139,  139,  139,  139,
-      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
-      140,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-      138,  135,  135,  135,  141,  135,  135,  135,  135,  139,
-      139,  139,  139,  139,  140,  140,  140,  140,  140,  140,
-      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
-      140,  140,  140,  140,  135,  141,  135,  139,  139,  139,
-      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
-
-      140,  140,  140,  140,  140,  139,  139,  139,  140,  140,
-      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
-      139,  139,  140,  140,  140,  140,  140,  139,  140,  140,
-      139,  140,  139,  140,    0,  135,  135,  135,  135,  135,
-      135
-    } ;
-
-static const flex_int16_t yy_nxt[244] =
-    {   0,
-        8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
-       18,   19,   20,   21,   22,   23,   24,   25,    8,   26,
-       27,   27,   28,   29,   27,   30,   27,   27,   27,   27,
-       27,    8,   31,   31,   31,   32,   31,   33,   34,   31,
-       35,   36,   37,   38,   39,   31,   31,   40,   31,   31,
-       41,   42,   43,   44,   46,   46,   52,   57,   61,   47,
-       47,   63,   66,   68,   58,   76,   52,   70,   69,   67,
-       72,   77,   64,   61,   71,   51,   63,   66,   78,   88,
-       82,   73,   90,   53,   79,   74,   83,   91,   96,   75,
-      106,   96,   88,   53,  108,  109,  114,   90,  121,  122,
-
-       91,   65,   51,   96,  123,   51,   96,  106,  108,   51,
-      114,  125,  109,   51,  128,  121,  122,  129,   51,  131,
-      132,  123,  133,  134,   60,  130,  127,  126,  125,  128,
-      124,  120,  129,  119,  118,  117,  131,  132,  116,  133,
-      134,   45,   45,   45,   48,   48,   48,   51,  115,   51,
-       86,   86,   86,  113,  112,  111,  110,  107,   87,  105,
-      104,  103,  102,  101,  100,   99,   98,   97,   95,   94,
-       93,   92,   89,   56,   87,   49,   85,   84,   81,   80,
-       62,   59,   56,   55,   54,   50,   49,  135,    7,  135,
-      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-
-      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-      135,  135,  135
+    {
+            0,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+            3,     1,     1,     4,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     2,     1,     5,     1,     1,     1,     1,     1,
+            6,     7,     8,     9,    10,    11,    12,    13,    14,    14,
+           14,    14,    14,    14,    14,    14,    14,    14,    15,    16,
+           17,    18,    19,     1,    20,    21,    21,    21,    21,    21,
+           21,    21,    21,    21,    21,    21,    21,    21,    21,    21,
+           21,    21,    21,    21,    21,    21,    21,    21,    21,    21,
+           21,     1,    22,     1,     1,    23,     1,    23,    24,    23,
+           23,    23,    24,    23,    23,    23,    23,    23,    23,    23,
+           24,    23,    23,    23,    23,    23,    24,    23,    23,    23,
+           23,    23,    23,    25,     1,    26,    27,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+            1,     1,     1,     1,     1,     1
     } ;
-
-static const flex_int16_t yy_chk[244] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    3,    4,   12,   24,   28,    3,
-        4,   30,   32,   33,   24,   36,   51,   34,   33,   32,
-       35,   36,   30,   28,   34,   53,   30,   32,   37,   61,
-       40,   35,   63,   12,   37,   35,   40,   66,   72,   35,
-       88,   74,   61,   51,   90,   91,   96,   63,  106,  108,
-
-       66,  140,   53,   72,  109,   53,   74,   88,   90,   53,
-       96,  114,   91,   53,  122,  106,  108,  125,   53,  128,
-      129,  109,  131,  132,  139,  126,  120,  115,  114,  122,
-      113,  105,  125,  104,  103,  102,  128,  129,   99,  131,
-      132,  136,  136,  136,  137,  137,  137,  138,   97,  138,
-      141,  141,  141,   95,   94,   93,   92,   89,   86,   84,
-       83,   82,   81,   79,   78,   77,   76,   75,   70,   69,
-       68,   67,   62,   56,   55,   49,   47,   41,   39,   38,
-       29,   25,   21,   18,   13,   11,    9,    7,  135,  135,
-      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-
-      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
-      135,  135,  135
+static const flex_int16_t yy_nxt[54][YY_NUM_EC] =
+    {
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {52,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,7,25,26,7,27,27,28,29,30},
+    {52,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,7,25,26,7,27,27,28,29,30},
+    {52,31,31,32,31,31,31,31,33,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31},
+    {52,31,31,32,31,31,31,31,33,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31},
+    {52,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34},
+    {52,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34},
+    {52,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7},
+    {52,-8,35,35,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8},
+    {52,-9,35,35,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9,-9},
+    {52,-10,-10,36,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10,-10},
+    {52,37,37,-11,37,38,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,39,37,37,37,37,37},
+    {52,-12,-12,-12,-12,-12,-12,-12,40,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12,-12},
+    {52,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13,-13},
+    {52,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14},
+    {52,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15,-15},
+    {52,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16},
+    {52,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,41,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17},
+    {52,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18,-18},
+    {52,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19},
+    {52,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,42,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20,-20},
+    {52,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21},
+    {52,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22,-22},
+    {52,-23,-23,-23,-23,-23,-23,-23,-23,-23,-23,43,-23,-23,-23,-23,-23,-23,44,-23,-23,-23,-23,-23,-23,-23,-23,-23},
+    {52,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,-24,45,-24,-24,-24,-24,-24,-24,-24,-24},
+    {52,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25},
+    {52,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,46,-26,-26,-26,-26,-26,-26,46,-26,46,46,-26,-26,-26},
+    {52,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,-27,47,-27,-27,-27,-27,-27,-27,47,-27,47,47,-27,-27,-27},
+    {52,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28},
+    {52,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29,-29},
+    {52,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30,-30},
+    {52,48,48,-31,48,48,48,48,-31,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48},
+    {52,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32},
+    {52,-33,-33,-33,-33,-33,-33,49,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33,-33},
+    {52,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34},
+    {52,-35,35,35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35,-35},
+    {52,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36,-36},
+    {52,37,37,-37,37,38,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,39,37,37,37,37,37},
+    {52,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38,-38},
+    {52,-39,-39,-39,-39,50,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,-39,50,-39,50,-39,-39,-39},
+    {52,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40,-40},
+    {52,51,51,-41,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51},
+    {52,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42},
+    {52,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43,-43},
+    {52,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44,-44},
+    {52,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45,-45},
+    {52,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,-46,46,-46,-46,-46,-46,-46,-46,46,-46,46,46,-46,-46,-46},
+    {52,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,47,-47,-47,-47,-47,-47,-47,47,-47,47,47,-47,-47,-47},
+    {52,48,48,-48,48,48,48,48,-48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48},
+    {52,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49,-49},
+    {52,37,37,-50,37,38,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,39,37,37,37,37,37},
+    {52,51,51,-51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51},
+    {-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52},
+    {-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53,-53}
     } ;
 
-/* Table of booleans, true if rule could match eol. */
-static const flex_int32_t yy_rule_can_match_eol[54] =
-    {   0,
-0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,     };
-
-static yy_state_type yy_last_accepting_state;
-static char *yy_last_accepting_cpos;
-
-extern int yy_flex_debug;
-int yy_flex_debug = 0;
-
-/* The intent behind this definition is that it'll catch
- * any uses of REJECT which flex missed.
- */
 #define REJECT reject_used_but_not_detected
 #define yymore() yymore_used_but_not_detected
 #define YY_MORE_ADJ 0
 #define YY_RESTORE_YY_MORE_OFFSET
-char *yytext;
+
 #line 1 "cool.l"
 /*
  * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
@@ -573,124 +279,142 @@ char *yytext;
  * 2022066017 응용물리학과 이규현
  */
 #define YY_NO_INPUT 1
-#line 10 "cool.l"
+#define YY_NO_UNPUT 1
+#line 11 "cool.l"
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
 #include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "node.h"
 #include "cool.tab.h"
-#line 583 "lex.yy.c"
+#include "cool_lexer.h"
+#include "keyword.h"
+#include "intern.h"
+#include "lexprof.h"
+
+/* 파서가 부르는 yylex()와 겹치지 않도록 스캐너 함수의 이름을 바꾼다 */
+#define YY_DECL int cool_yylex(yyscan_t yyscanner)
+
+/*
+ * 렉심마다 바이트 오프셋을 센다. 줄은 세지 않고 필요할 때 오프셋으로 구한다.
+ * 프로파일 빌드에서는 규칙(yy_act)별로 센다(lexprof.h).
+ */
+#define YY_USER_ACTION { \
+    yyextra->tokenOffset = yyextra->nextOffset; \
+    yyextra->nextOffset += yyleng; \
+    LEXPROF_MATCH(&yyextra->prof, yy_act, YY_START, yytext, yyleng); \
+}
+
+/*
+ * 스트림 입력은 flex가 버퍼를 다시 채우면서 지나간 내용을 버리므로 읽는 즉시 줄바꿈을
+ * 색인한다. 버퍼 입력은 줄번호가 필요할 때 cool_lexer_line()이 색인한다.
+ */
+#define YY_INPUT(buf, result, max_size) { \
+    errno = 0; \
+    while ((result = fread(buf, 1, max_size, yyin)) == 0 && ferror(yyin)) { \
+        if (errno != EINTR) \
+            YY_FATAL_ERROR("input in flex scanner failed"); \
+        errno = 0; \
+        clearerr(yyin); \
+    } \
+    if (lineidx_add(&yyextra->lines, buf, result) < 0) \
+        YY_FATAL_ERROR("out of memory in line index"); \
+}
 
-#line 585 "lex.yy.c"
+static void set_string(cool_lexer_t *lx, const char *s, size_t len);
+static int int_value(const char *s, size_t len, int *value);
+#line 67 "cool.l"
+    /*
+     * 어떤 규칙의 앞부분도 그 자체로 다른 규칙에 맞도록 정의하여 스캐너가 되돌아가지
+     * 않게 한다(flex -b가 "No backing up."을 보고해야 한다. Makefile에서 검사한다).
+     * 역추적이 없어야 전체 표(-Cfe)로 만든 스캐너가 마지막 수락 상태를 기록하지 않는다.
+     * 한 줄 주석은 줄바꿈 앞에서 끝나며 줄바꿈은 공백 규칙이 건너뛴다.
+     */
+#line 341 "lex.yy.c"
 
 #define INITIAL 0
 #define COMMENT 1
 #define S_LINE_COMMENT 2
 
 #ifndef YY_NO_UNISTD_H
-/* Special case for "unistd.h", since it is non-ANSI. We include it way
- * down here because we want the user's section 1 to have been scanned first.
- * The user has a chance to override it with an option.
- */
 #include <unistd.h>
 #endif
 
+#define YY_EXTRA_TYPE cool_lexer_t *
+
 #ifndef YY_EXTRA_TYPE
 #define YY_EXTRA_TYPE void *
 #endif
 
-static int yy_init_globals ( void );
-
-/* Accessor methods to globals.
-   These are made visible to non-reentrant scanners for convenience. */
-
-int yylex_destroy ( void );
-
-int yyget_debug ( void );
-
-void yyset_debug ( int debug_flag  );
-
-YY_EXTRA_TYPE yyget_extra ( void );
-
-void yyset_extra ( YY_EXTRA_TYPE user_defined  );
-
-FILE *yyget_in ( void );
-
-void yyset_in  ( FILE * _in_str  );
-
-FILE *yyget_out ( void );
-
-void yyset_out  ( FILE * _out_str  );
-
-			yy_size_t yyget_leng ( void );
-
-char *yyget_text ( void );
-
-int yyget_lineno ( void );
-
-void yyset_lineno ( int _line_number  );
-
-/* Macros after this point can all be overridden by user definitions in
- * section 1.
- */
-
-#ifndef YY_SKIP_YYWRAP
-#ifdef __cplusplus
-extern "C" int yywrap ( void );
-#else
-extern int yywrap ( void );
-#endif
-#endif
-
-#ifndef YY_NO_UNPUT
-    
-#endif
+/* Holds the entire state of the reentrant scanner. */
+struct yyguts_t
+    {
+    YY_EXTRA_TYPE yyextra_r;
+    FILE *yyin_r, *yyout_r;
+    size_t yy_buffer_stack_top; /**< index of top of stack. */
+    size_t yy_buffer_stack_max; /**< capacity of stack. */
+    YY_BUFFER_STATE * yy_buffer_stack; /**< Stack as an array. */
+    char yy_hold_char;
+    int yy_n_chars;
+    int yyleng_r;
+    char *yy_c_buf_p;
+    int yy_init;
+    int yy_start;
+    int yy_did_buffer_switch_on_eof;
+    int yy_start_stack_ptr;
+    int yy_start_stack_depth;
+    int *yy_start_stack;
+    yy_state_type yy_last_accepting_state;
+    char* yy_last_accepting_cpos;
+    int yylineno_r;
+    int yy_flex_debug_r;
+    char *yytext_r;
+    int yy_more_flag;
+    int yy_more_len;
+    }; /* end struct yyguts_t */
+
+static int yy_init_globals ( yyscan_t yyscanner );
+
+int yylex_init (yyscan_t* scanner);
+int yylex_init_extra ( YY_EXTRA_TYPE user_defined, yyscan_t* scanner);
+int yylex_destroy ( yyscan_t yyscanner );
+int yyget_debug ( yyscan_t yyscanner );
+void yyset_debug ( int debug_flag , yyscan_t yyscanner );
+YY_EXTRA_TYPE yyget_extra ( yyscan_t yyscanner );
+void yyset_extra ( YY_EXTRA_TYPE user_defined , yyscan_t yyscanner );
+FILE *yyget_in ( yyscan_t yyscanner );
+void yyset_in  ( FILE * _in_str , yyscan_t yyscanner );
+FILE *yyget_out ( yyscan_t yyscanner );
+void yyset_out  ( FILE * _out_str , yyscan_t yyscanner );
+int yyget_leng ( yyscan_t yyscanner );
+char *yyget_text ( yyscan_t yyscanner );
+int yyget_lineno ( yyscan_t yyscanner );
+void yyset_lineno ( int _line_number , yyscan_t yyscanner );
+int yyget_column  ( yyscan_t yyscanner );
+void yyset_column ( int _column_no , yyscan_t yyscanner );
 
-#ifndef yytext_ptr
-static void yy_flex_strncpy ( char *, const char *, int );
-#endif
 
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen ( const char * );
-#endif
-
-#ifndef YY_NO_INPUT
-#ifdef __cplusplus
-static int yyinput ( void );
-#else
-static int input ( void );
-#endif
-
-#endif
-
-/* Amount of stuff to slurp up with each read. */
 #ifndef YY_READ_BUF_SIZE
-#ifdef __ia64__
-/* On IA-64, the buffer size is 16k, not 8k */
-#define YY_READ_BUF_SIZE 16384
-#else
 #define YY_READ_BUF_SIZE 8192
-#endif /* __ia64__ */
 #endif
 
-/* Copy whatever the last rule matched to the standard output. */
 #ifndef ECHO
-/* This used to be an fputs(), but since the string might contain NUL's,
- * we now use fwrite().
- */
 #define ECHO do { if (fwrite( yytext, (size_t) yyleng, 1, yyout )) {} } while (0)
 #endif
 
-/* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
- * is returned in "result".
- */
 #ifndef YY_INPUT
 #define YY_INPUT(buf,result,max_size) \
 	if ( YY_CURRENT_BUFFER_LVALUE->yy_is_interactive ) \
 		{ \
 		int c = '*'; \
-		yy_size_t n; \
+		int n; \
 		for ( n = 0; n < max_size && \
 			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
 			buf[n] = (char) c; \
@@ -714,49 +438,33 @@ static int input ( void );
 			clearerr(yyin); \
 			} \
 		}\
-\
 
 #endif
 
-/* No semi-colon after return; correct usage is to write "yyterminate();" -
- * we don't want an extra ';' after the "return" because that will cause
- * some compilers to complain about unreachable statements.
- */
 #ifndef yyterminate
 #define yyterminate() return YY_NULL
 #endif
 
-/* Number of entries by which start-condition stack grows. */
 #ifndef YY_START_STACK_INCR
 #define YY_START_STACK_INCR 25
 #endif
 
-/* Report a fatal error. */
 #ifndef YY_FATAL_ERROR
-#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
+#define YY_FATAL_ERROR(msg) yy_fatal_error( msg , yyscanner)
 #endif
 
-/* end tables serialization structures and prototypes */
-
-/* Default declaration of generated scanner - a define so the user can
- * easily add parameters.
- */
 #ifndef YY_DECL
 #define YY_DECL_IS_OURS 1
 
-extern int yylex (void);
+extern int yylex (yyscan_t yyscanner);
 
-#define YY_DECL int yylex (void)
+#define YY_DECL int yylex (yyscan_t yyscanner)
 #endif /* !YY_DECL */
 
-/* Code executed at the beginning of each rule, after yytext and yyleng
- * have been set up.
- */
 #ifndef YY_USER_ACTION
 #define YY_USER_ACTION
 #endif
 
-/* Code executed at the end of each rule. */
 #ifndef YY_BREAK
 #define YY_BREAK /*LINTED*/break;
 #endif
@@ -764,6 +472,7 @@ extern int yylex (void);
 #define YY_RULE_SETUP \
 	YY_USER_ACTION
 
+
 /** The main scanner function which does all the work.
  */
 YY_DECL
@@ -771,17 +480,18 @@ YY_DECL
 	yy_state_type yy_current_state;
 	char *yy_cp, *yy_bp;
 	int yy_act;
-    
-	if ( !(yy_init) )
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	if ( !yyg->yy_init )
 		{
-		(yy_init) = 1;
+		yyg->yy_init = 1;
 
 #ifdef YY_USER_INIT
 		YY_USER_INIT;
 #endif
 
-		if ( ! (yy_start) )
-			(yy_start) = 1;	/* first start state */
+		if ( ! yyg->yy_start )
+			yyg->yy_start = 1;	/* first start state */
 
 		if ( ! yyin )
 			yyin = stdin;
@@ -790,455 +500,311 @@ YY_DECL
 			yyout = stdout;
 
 		if ( ! YY_CURRENT_BUFFER ) {
-			yyensure_buffer_stack ();
+			yyensure_buffer_stack (yyscanner);
 			YY_CURRENT_BUFFER_LVALUE =
-				yy_create_buffer( yyin, YY_BUF_SIZE );
+				yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner);
 		}
 
-		yy_load_buffer_state(  );
+		yy_load_buffer_state( yyscanner );
 		}
 
 	{
-#line 27 "cool.l"
-
-
-#line 805 "lex.yy.c"
+#line 79 "cool.l"
+    LEXPROF_ENTER(&yyextra->prof);
+#line 515 "lex.yy.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
-		yy_cp = (yy_c_buf_p);
+		yy_cp = yyg->yy_c_buf_p;
 
 		/* Support of yytext. */
-		*yy_cp = (yy_hold_char);
+		*yy_cp = yyg->yy_hold_char;
 
 		/* yy_bp points to the position in yy_ch_buf of the start of
 		 * the current run.
 		 */
 		yy_bp = yy_cp;
 
-		yy_current_state = (yy_start);
+		yy_current_state = yyg->yy_start;
 yy_match:
-		do
-			{
-			YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)] ;
-			if ( yy_accept[yy_current_state] )
-				{
-				(yy_last_accepting_state) = yy_current_state;
-				(yy_last_accepting_cpos) = yy_cp;
-				}
-			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-				{
-				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 136 )
-					yy_c = yy_meta[yy_c];
-				}
-			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
+		while ( (yy_current_state = yy_nxt[yy_current_state][yy_ec[YY_SC_TO_UI(*yy_cp)]]) > 0 )
 			++yy_cp;
-			}
-		while ( yy_base[yy_current_state] != 189 );
+
+		yy_current_state = -yy_current_state;
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
 		if ( yy_act == 0 )
 			{ /* have to back up */
-			yy_cp = (yy_last_accepting_cpos);
-			yy_current_state = (yy_last_accepting_state);
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
 			yy_act = yy_accept[yy_current_state];
 			}
 
 		YY_DO_BEFORE_ACTION;
 
-		if ( yy_act != YY_END_OF_BUFFER && yy_rule_can_match_eol[yy_act] )
-			{
-			yy_size_t yyl;
-			for ( yyl = 0; yyl < yyleng; ++yyl )
-				if ( yytext[yyl] == '\n' )
-					
-    yylineno++;
-;
-			}
-
 do_action:	/* This label is used only to access EOF actions. */
 
 		switch ( yy_act )
 	{ /* beginning of action switch */
 			case 0: /* must back up */
 			/* undo the effects of YY_DO_BEFORE_ACTION */
-			*yy_cp = (yy_hold_char);
-			yy_cp = (yy_last_accepting_cpos);
-			yy_current_state = (yy_last_accepting_state);
+			*yy_cp = yyg->yy_hold_char;
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
 			goto yy_find_action;
 
 case 1:
 YY_RULE_SETUP
-#line 29 "cool.l"
+#line 82 "cool.l"
 { BEGIN(COMMENT); }
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 30 "cool.l"
+#line 83 "cool.l"
 { BEGIN(INITIAL); }
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 31 "cool.l"
+#line 84 "cool.l"
 /* Skip */;
 	YY_BREAK
 case 4:
-/* rule 4 can match eol */
 YY_RULE_SETUP
-#line 32 "cool.l"
+#line 85 "cool.l"
 /* Skip */;
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 34 "cool.l"
-/* SKIP */
+#line 86 "cool.l"
+/* Skip */;
 	YY_BREAK
 case 6:
-/* rule 6 can match eol */
 YY_RULE_SETUP
-#line 35 "cool.l"
-/* skip */
+#line 88 "cool.l"
+/* SKIP */
 	YY_BREAK
 case 7:
-/* rule 7 can match eol */
 YY_RULE_SETUP
-#line 36 "cool.l"
-/* skip */
+#line 89 "cool.l"
+/* SKIP */
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 38 "cool.l"
-{ return CLASS; }
+#line 90 "cool.l"
+/* SKIP */
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 39 "cool.l"
-{ return INHERITS; }
+#line 93 "cool.l"
+{
+    int kw = keyword_lookup(yytext, yyleng);
+    return kw ? kw : TYPE;
+}
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 41 "cool.l"
-{ return IF; }
+#line 98 "cool.l"
+{
+    int kw = keyword_lookup(yytext, yyleng);
+    return kw ? kw : ID;
+}
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 42 "cool.l"
-{ return IF; }
-	YY_BREAK
-case 12:
-YY_RULE_SETUP
-#line 43 "cool.l"
-{ return THEN; }
-	YY_BREAK
-case 13:
-YY_RULE_SETUP
-#line 44 "cool.l"
-{ return ELSE; }
-	YY_BREAK
-case 14:
-YY_RULE_SETUP
-#line 45 "cool.l"
-{ return ELSE; }
-	YY_BREAK
-case 15:
-YY_RULE_SETUP
-#line 46 "cool.l"
-{ return FI; }
-	YY_BREAK
-case 16:
-YY_RULE_SETUP
-#line 47 "cool.l"
-{ return WHILE; }
-	YY_BREAK
-case 17:
-YY_RULE_SETUP
-#line 48 "cool.l"
-{ return LOOP; }
-	YY_BREAK
-case 18:
-YY_RULE_SETUP
-#line 49 "cool.l"
-{ return POOL; }
-	YY_BREAK
-case 19:
-YY_RULE_SETUP
-#line 50 "cool.l"
-{ return LET; }
-	YY_BREAK
-case 20:
-YY_RULE_SETUP
-#line 51 "cool.l"
-{ return IN; }
-	YY_BREAK
-case 21:
-YY_RULE_SETUP
-#line 52 "cool.l"
-{ return CASE; }
-	YY_BREAK
-case 22:
-YY_RULE_SETUP
-#line 53 "cool.l"
-{ return OF; }
-	YY_BREAK
-case 23:
-YY_RULE_SETUP
-#line 54 "cool.l"
-{ return ESAC; }
-	YY_BREAK
-case 24:
-YY_RULE_SETUP
-#line 55 "cool.l"
-{ return NEW; }
-	YY_BREAK
-case 25:
-YY_RULE_SETUP
-#line 56 "cool.l"
-{ return ISVOID; }
-	YY_BREAK
-case 26:
-YY_RULE_SETUP
-#line 57 "cool.l"
-{ return TRUE; }
-	YY_BREAK
-case 27:
-YY_RULE_SETUP
-#line 58 "cool.l"
-{ return FALSE; }
-	YY_BREAK
-case 28:
-YY_RULE_SETUP
-#line 59 "cool.l"
-{ return NOT; }
-	YY_BREAK
-case 29:
-YY_RULE_SETUP
-#line 61 "cool.l"
-{ return TYPE; }
-	YY_BREAK
-case 30:
-YY_RULE_SETUP
-#line 63 "cool.l"
+#line 104 "cool.l"
 {
-    return ID;
+    if (int_value(yytext, yyleng, &yyextra->value) < 0) {
+        fprintf(stderr, "Integer %s out of range in line %d\n", yytext,
+                cool_lexer_line(yyextra, yyextra->tokenOffset));
+        yyextra->value = 0;
+    }
+    return INTEGER;
 }
 	YY_BREAK
-case 31:
+case 12:
 YY_RULE_SETUP
-#line 67 "cool.l"
+#line 113 "cool.l"
 {
-    return INTEGER;
+    /* 큰따옴표를 제외한 내용 */
+    set_string(yyextra, yytext + 1, yyleng - 2);
+    return STRING;
 }
 	YY_BREAK
-case 32:
+case 13:
 YY_RULE_SETUP
-#line 71 "cool.l"
+#line 120 "cool.l"
 {
-    /* 큰따옴표를 제외하고 문자열을 처리 */
-    char *str = strdup(yytext + 1);  /* 처음 큰따옴표 제거하고 복사 */
-    str[strlen(str) - 1] = '\0';  /* 마지막 큰따옴표 제거 */
-    free(str);  /* 할당된 메모리 해제 */
-    return STRING;
+    yyless(1);
+    yyextra->nextOffset = yyextra->tokenOffset + 1;
+    fprintf(stderr, "Skip unknown character %s in line %d\n", yytext,
+            cool_lexer_line(yyextra, yyextra->tokenOffset));
 }
 	YY_BREAK
-case 33:
+case 14:
 YY_RULE_SETUP
-#line 79 "cool.l"
+#line 127 "cool.l"
 { return '('; }
 	YY_BREAK
-case 34:
+case 15:
 YY_RULE_SETUP
-#line 80 "cool.l"
+#line 128 "cool.l"
 { return ')'; }
 	YY_BREAK
-case 35:
+case 16:
 YY_RULE_SETUP
-#line 81 "cool.l"
+#line 129 "cool.l"
 { return '{'; }
 	YY_BREAK
-case 36:
+case 17:
 YY_RULE_SETUP
-#line 82 "cool.l"
+#line 130 "cool.l"
 { return '}'; }
 	YY_BREAK
-case 37:
+case 18:
 YY_RULE_SETUP
-#line 83 "cool.l"
+#line 131 "cool.l"
 { return LTE; }
 	YY_BREAK
-case 38:
+case 19:
 YY_RULE_SETUP
-#line 84 "cool.l"
+#line 132 "cool.l"
 { return ASSIGN; }
 	YY_BREAK
-case 39:
+case 20:
 YY_RULE_SETUP
-#line 85 "cool.l"
+#line 133 "cool.l"
 { return '<'; }
 	YY_BREAK
-case 40:
+case 21:
 YY_RULE_SETUP
-#line 86 "cool.l"
+#line 134 "cool.l"
 { return DARROW; }
 	YY_BREAK
-case 41:
+case 22:
 YY_RULE_SETUP
-#line 87 "cool.l"
+#line 135 "cool.l"
 { return '='; }
 	YY_BREAK
-case 42:
+case 23:
 YY_RULE_SETUP
-#line 88 "cool.l"
+#line 136 "cool.l"
 { return ','; }
 	YY_BREAK
-case 43:
+case 24:
 YY_RULE_SETUP
-#line 89 "cool.l"
+#line 137 "cool.l"
 { return ';'; }
 	YY_BREAK
-case 44:
+case 25:
 YY_RULE_SETUP
-#line 90 "cool.l"
+#line 138 "cool.l"
 { return ':'; }
 	YY_BREAK
-case 45:
+case 26:
 YY_RULE_SETUP
-#line 91 "cool.l"
+#line 139 "cool.l"
 { return '.'; }
 	YY_BREAK
-case 46:
+case 27:
 YY_RULE_SETUP
-#line 92 "cool.l"
+#line 140 "cool.l"
 { return '+'; }
 	YY_BREAK
-case 47:
+case 28:
 YY_RULE_SETUP
-#line 93 "cool.l"
+#line 141 "cool.l"
 { return '-'; }
 	YY_BREAK
-case 48:
+case 29:
 YY_RULE_SETUP
-#line 94 "cool.l"
+#line 142 "cool.l"
 { return '*'; }
 	YY_BREAK
-case 49:
+case 30:
 YY_RULE_SETUP
-#line 95 "cool.l"
+#line 143 "cool.l"
 { return '/'; }
 	YY_BREAK
-case 50:
+case 31:
 YY_RULE_SETUP
-#line 96 "cool.l"
+#line 144 "cool.l"
 { return '~'; }
 	YY_BREAK
-case 51:
+case 32:
 YY_RULE_SETUP
-#line 97 "cool.l"
+#line 145 "cool.l"
 { return '@'; }
 	YY_BREAK
-case 52:
+case 33:
 YY_RULE_SETUP
-#line 98 "cool.l"
-{ fprintf(stderr, "Skip unknown character %s in line %d\n", yytext, yylineno); }
+#line 146 "cool.l"
+{ fprintf(stderr, "Skip unknown character %s in line %d\n", yytext,
+                  cool_lexer_line(yyextra, yyextra->tokenOffset)); }
 	YY_BREAK
-case 53:
+case 34:
 YY_RULE_SETUP
-#line 100 "cool.l"
+#line 748 "lex.yy.c"
 ECHO;
 	YY_BREAK
-#line 1150 "lex.yy.c"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(COMMENT):
 case YY_STATE_EOF(S_LINE_COMMENT):
 	yyterminate();
+#line 755 "lex.yy.c"
 
 	case YY_END_OF_BUFFER:
 		{
 		/* Amount of text matched not including the EOB char. */
-		int yy_amount_of_matched_text = (int) (yy_cp - (yytext_ptr)) - 1;
+		int yy_amount_of_matched_text = (int) (yy_cp - yyg->yytext_ptr) - 1;
 
 		/* Undo the effects of YY_DO_BEFORE_ACTION. */
-		*yy_cp = (yy_hold_char);
+		*yy_cp = yyg->yy_hold_char;
 		YY_RESTORE_YY_MORE_OFFSET
 
 		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
 			{
-			/* We're scanning a new file or input source.  It's
-			 * possible that this happened because the user
-			 * just pointed yyin at a new source and called
-			 * yylex().  If so, then we have to assure
-			 * consistency between YY_CURRENT_BUFFER and our
-			 * globals.  Here is the right place to do so, because
-			 * this is the first action (other than possibly a
-			 * back-up) that will match for the new input source.
-			 */
-			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+			yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
 			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
 			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
 			}
 
-		/* Note that here we test for yy_c_buf_p "<=" to the position
-		 * of the first EOB in the buffer, since yy_c_buf_p will
-		 * already have been incremented past the NUL character
-		 * (since all states make transitions on EOB to the
-		 * end-of-buffer state).  Contrast this with the test
-		 * in input().
-		 */
-		if ( (yy_c_buf_p) <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
+		if ( yyg->yy_c_buf_p <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] )
 			{ /* This was really a NUL. */
 			yy_state_type yy_next_state;
 
-			(yy_c_buf_p) = (yytext_ptr) + yy_amount_of_matched_text;
+			yyg->yy_c_buf_p = yyg->yytext_ptr + yy_amount_of_matched_text;
 
-			yy_current_state = yy_get_previous_state(  );
+			yy_current_state = yy_get_previous_state( yyscanner );
 
-			/* Okay, we're now positioned to make the NUL
-			 * transition.  We couldn't have
-			 * yy_get_previous_state() go ahead and do it
-			 * for us because it doesn't know how to deal
-			 * with the possibility of jamming (and we don't
-			 * want to build jamming into it because then it
-			 * will run more slowly).
-			 */
+			yy_next_state = yy_try_NUL_trans( yy_current_state , yyscanner);
 
-			yy_next_state = yy_try_NUL_trans( yy_current_state );
-
-			yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+			yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 
 			if ( yy_next_state )
 				{
 				/* Consume the NUL. */
-				yy_cp = ++(yy_c_buf_p);
+				yy_cp = ++yyg->yy_c_buf_p;
 				yy_current_state = yy_next_state;
 				goto yy_match;
 				}
 
 			else
 				{
-				yy_cp = (yy_c_buf_p);
+				yy_cp = yyg->yy_c_buf_p;
 				goto yy_find_action;
 				}
 			}
 
-		else switch ( yy_get_next_buffer(  ) )
+		else switch ( yy_get_next_buffer( yyscanner ) )
 			{
 			case EOB_ACT_END_OF_FILE:
 				{
-				(yy_did_buffer_switch_on_eof) = 0;
+				yyg->yy_did_buffer_switch_on_eof = 0;
 
-				if ( yywrap(  ) )
+				if ( yywrap( yyscanner ) )
 					{
-					/* Note: because we've taken care in
-					 * yy_get_next_buffer() to have set up
-					 * yytext, we can now set up
-					 * yy_c_buf_p so that if some total
-					 * hoser (like flex itself) wants to
-					 * call the scanner after we return the
-					 * YY_NULL, it'll still work - another
-					 * YY_NULL will get returned.
-					 */
-					(yy_c_buf_p) = (yytext_ptr) + YY_MORE_ADJ;
+					yyg->yy_c_buf_p = yyg->yytext_ptr + YY_MORE_ADJ;
 
 					yy_act = YY_STATE_EOF(YY_START);
 					goto do_action;
@@ -1246,30 +812,30 @@ case YY_STATE_EOF(S_LINE_COMMENT):
 
 				else
 					{
-					if ( ! (yy_did_buffer_switch_on_eof) )
+					if ( ! yyg->yy_did_buffer_switch_on_eof )
 						YY_NEW_FILE;
 					}
 				break;
 				}
 
 			case EOB_ACT_CONTINUE_SCAN:
-				(yy_c_buf_p) =
-					(yytext_ptr) + yy_amount_of_matched_text;
+				yyg->yy_c_buf_p =
+					yyg->yytext_ptr + yy_amount_of_matched_text;
 
-				yy_current_state = yy_get_previous_state(  );
+				yy_current_state = yy_get_previous_state( yyscanner );
 
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 				goto yy_match;
 
 			case EOB_ACT_LAST_MATCH:
-				(yy_c_buf_p) =
-				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)];
+				yyg->yy_c_buf_p =
+				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars];
 
-				yy_current_state = yy_get_previous_state(  );
+				yy_current_state = yy_get_previous_state( yyscanner );
 
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 				goto yy_find_action;
 			}
 		break;
@@ -1283,39 +849,28 @@ case YY_STATE_EOF(S_LINE_COMMENT):
 	} /* end of user's declarations */
 } /* end of yylex */
 
-/* yy_get_next_buffer - try to read in a new buffer
- *
- * Returns a code representing an action:
- *	EOB_ACT_LAST_MATCH -
- *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
- *	EOB_ACT_END_OF_FILE - end of file
- */
-static int yy_get_next_buffer (void)
+
+static int yy_get_next_buffer (yyscan_t yyscanner)
 {
-    	char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
-	char *source = (yytext_ptr);
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
+	char *source = yyg->yytext_ptr;
 	int number_to_move, i;
 	int ret_val;
 
-	if ( (yy_c_buf_p) > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] )
+	if ( yyg->yy_c_buf_p > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] )
 		YY_FATAL_ERROR(
 		"fatal flex scanner internal error--end of buffer missed" );
 
 	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
 		{ /* Don't try to fill the buffer, so this is an EOF. */
-		if ( (yy_c_buf_p) - (yytext_ptr) - YY_MORE_ADJ == 1 )
+		if ( yyg->yy_c_buf_p - yyg->yytext_ptr - YY_MORE_ADJ == 1 )
 			{
-			/* We matched a single character, the EOB, so
-			 * treat this as a final EOF.
-			 */
 			return EOB_ACT_END_OF_FILE;
 			}
 
 		else
 			{
-			/* We matched some text prior to the EOB, first
-			 * process it.
-			 */
 			return EOB_ACT_LAST_MATCH;
 			}
 		}
@@ -1323,20 +878,17 @@ static int yy_get_next_buffer (void)
 	/* Try to read more data. */
 
 	/* First move last chars to start of buffer. */
-	number_to_move = (int) ((yy_c_buf_p) - (yytext_ptr) - 1);
+	number_to_move = (int) (yyg->yy_c_buf_p - yyg->yytext_ptr - 1);
 
 	for ( i = 0; i < number_to_move; ++i )
 		*(dest++) = *(source++);
 
 	if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_EOF_PENDING )
-		/* don't do the read, it's not guaranteed to return an EOF,
-		 * just force an EOF
-		 */
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars) = 0;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars = 0;
 
 	else
 		{
-			yy_size_t num_to_read =
+			int num_to_read =
 			YY_CURRENT_BUFFER_LVALUE->yy_buf_size - number_to_move - 1;
 
 		while ( num_to_read <= 0 )
@@ -1346,11 +898,11 @@ static int yy_get_next_buffer (void)
 			YY_BUFFER_STATE b = YY_CURRENT_BUFFER_LVALUE;
 
 			int yy_c_buf_p_offset =
-				(int) ((yy_c_buf_p) - b->yy_ch_buf);
+				(int) (yyg->yy_c_buf_p - b->yy_ch_buf);
 
 			if ( b->yy_is_our_buffer )
 				{
-				yy_size_t new_size = b->yy_buf_size * 2;
+				int new_size = b->yy_buf_size * 2;
 
 				if ( new_size <= 0 )
 					b->yy_buf_size += b->yy_buf_size / 8;
@@ -1360,7 +912,7 @@ static int yy_get_next_buffer (void)
 				b->yy_ch_buf = (char *)
 					/* Include room in for 2 EOB chars. */
 					yyrealloc( (void *) b->yy_ch_buf,
-							 (yy_size_t) (b->yy_buf_size + 2)  );
+							 (yy_size_t) (b->yy_buf_size + 2) , yyscanner );
 				}
 			else
 				/* Can't grow it, we don't own it. */
@@ -1370,7 +922,7 @@ static int yy_get_next_buffer (void)
 				YY_FATAL_ERROR(
 				"fatal error - scanner input buffer overflow" );
 
-			(yy_c_buf_p) = &b->yy_ch_buf[yy_c_buf_p_offset];
+			yyg->yy_c_buf_p = &b->yy_ch_buf[yy_c_buf_p_offset];
 
 			num_to_read = YY_CURRENT_BUFFER_LVALUE->yy_buf_size -
 						number_to_move - 1;
@@ -1382,17 +934,17 @@ static int yy_get_next_buffer (void)
 
 		/* Read in more data. */
 		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
-			(yy_n_chars), num_to_read );
+			yyg->yy_n_chars, num_to_read );
 
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
-	if ( (yy_n_chars) == 0 )
+	if ( yyg->yy_n_chars == 0 )
 		{
 		if ( number_to_move == YY_MORE_ADJ )
 			{
 			ret_val = EOB_ACT_END_OF_FILE;
-			yyrestart( yyin  );
+			yyrestart( yyin  , yyscanner);
 			}
 
 		else
@@ -1406,264 +958,131 @@ static int yy_get_next_buffer (void)
 	else
 		ret_val = EOB_ACT_CONTINUE_SCAN;
 
-	if (((yy_n_chars) + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
+	if ((yyg->yy_n_chars + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
 		/* Extend the array by 50%, plus the number we really need. */
-		yy_size_t new_size = (yy_n_chars) + number_to_move + ((yy_n_chars) >> 1);
+		int new_size = yyg->yy_n_chars + number_to_move + (yyg->yy_n_chars >> 1);
 		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) yyrealloc(
-			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size  );
+			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size , yyscanner );
 		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
 			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
 		/* "- 2" to take care of EOB's */
 		YY_CURRENT_BUFFER_LVALUE->yy_buf_size = (int) (new_size - 2);
 	}
 
-	(yy_n_chars) += number_to_move;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] = YY_END_OF_BUFFER_CHAR;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] = YY_END_OF_BUFFER_CHAR;
+	yyg->yy_n_chars += number_to_move;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] = YY_END_OF_BUFFER_CHAR;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] = YY_END_OF_BUFFER_CHAR;
 
-	(yytext_ptr) = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
+	yyg->yytext_ptr = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
 
 	return ret_val;
 }
 
 /* yy_get_previous_state - get the state just before the EOB char was reached */
 
-    static yy_state_type yy_get_previous_state (void)
+    static yy_state_type yy_get_previous_state (yyscan_t yyscanner)
 {
 	yy_state_type yy_current_state;
 	char *yy_cp;
-    
-	yy_current_state = (yy_start);
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
-	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
+	yy_current_state = yyg->yy_start;
+
+	for ( yy_cp = yyg->yytext_ptr + YY_MORE_ADJ; yy_cp < yyg->yy_c_buf_p; ++yy_cp )
 		{
-		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
-		if ( yy_accept[yy_current_state] )
-			{
-			(yy_last_accepting_state) = yy_current_state;
-			(yy_last_accepting_cpos) = yy_cp;
-			}
-		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-			{
-			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 136 )
-				yy_c = yy_meta[yy_c];
-			}
-		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
+		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : YY_NUL_EC);
+		yy_current_state = yy_nxt[yy_current_state][yy_c];
 		}
 
 	return yy_current_state;
 }
 
-/* yy_try_NUL_trans - try to make a transition on the NUL character
- *
- * synopsis
- *	next_state = yy_try_NUL_trans( current_state );
- */
-    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state )
+    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state , yyscan_t yyscanner)
 {
 	int yy_is_jam;
-    	char *yy_cp = (yy_c_buf_p);
-
-	YY_CHAR yy_c = 1;
-	if ( yy_accept[yy_current_state] )
-		{
-		(yy_last_accepting_state) = yy_current_state;
-		(yy_last_accepting_cpos) = yy_cp;
-		}
-	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-		{
-		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 136 )
-			yy_c = yy_meta[yy_c];
-		}
-	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 135);
-
-		return yy_is_jam ? 0 : yy_current_state;
-}
-
-#ifndef YY_NO_UNPUT
-
-#endif
-
-#ifndef YY_NO_INPUT
-#ifdef __cplusplus
-    static int yyinput (void)
-#else
-    static int input  (void)
-#endif
-
-{
-	int c;
-    
-	*(yy_c_buf_p) = (yy_hold_char);
-
-	if ( *(yy_c_buf_p) == YY_END_OF_BUFFER_CHAR )
-		{
-		/* yy_c_buf_p now points to the character we want to return.
-		 * If this occurs *before* the EOB characters, then it's a
-		 * valid NUL; if not, then we've hit the end of the buffer.
-		 */
-		if ( (yy_c_buf_p) < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
-			/* This was really a NUL. */
-			*(yy_c_buf_p) = '\0';
-
-		else
-			{ /* need more input */
-			yy_size_t offset = (yy_c_buf_p) - (yytext_ptr);
-			++(yy_c_buf_p);
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner; /* This var may be unused depending upon options. */
+	char *yy_cp = yyg->yy_c_buf_p;
 
-			switch ( yy_get_next_buffer(  ) )
-				{
-				case EOB_ACT_LAST_MATCH:
-					/* This happens because yy_g_n_b()
-					 * sees that we've accumulated a
-					 * token and flags that we need to
-					 * try matching the token before
-					 * proceeding.  But for input(),
-					 * there's no matching to consider.
-					 * So convert the EOB_ACT_LAST_MATCH
-					 * to EOB_ACT_END_OF_FILE.
-					 */
-
-					/* Reset buffer status. */
-					yyrestart( yyin );
-
-					/*FALLTHROUGH*/
-
-				case EOB_ACT_END_OF_FILE:
-					{
-					if ( yywrap(  ) )
-						return 0;
+	YY_CHAR yy_c = YY_NUL_EC;
+	yy_current_state = yy_nxt[yy_current_state][yy_c];
+	yy_is_jam = (yy_current_state <= 0);
 
-					if ( ! (yy_did_buffer_switch_on_eof) )
-						YY_NEW_FILE;
-#ifdef __cplusplus
-					return yyinput();
-#else
-					return input();
-#endif
-					}
+	(void)yy_cp;
 
-				case EOB_ACT_CONTINUE_SCAN:
-					(yy_c_buf_p) = (yytext_ptr) + offset;
-					break;
-				}
-			}
-		}
-
-	c = *(unsigned char *) (yy_c_buf_p);	/* cast for 8-bit char's */
-	*(yy_c_buf_p) = '\0';	/* preserve yytext */
-	(yy_hold_char) = *++(yy_c_buf_p);
-
-	if ( c == '\n' )
-		
-    yylineno++;
-;
-
-	return c;
+	(void)yyg;
+	return yy_is_jam ? 0 : yy_current_state;
 }
-#endif	/* ifndef YY_NO_INPUT */
 
-/** Immediately switch to a different input stream.
- * @param input_file A readable stream.
- * 
- * @note This function does not reset the start condition to @c INITIAL .
- */
-    void yyrestart  (FILE * input_file )
+    void yyrestart  (FILE * input_file , yyscan_t yyscanner)
 {
-    
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
 	if ( ! YY_CURRENT_BUFFER ){
-        yyensure_buffer_stack ();
+        yyensure_buffer_stack (yyscanner);
 		YY_CURRENT_BUFFER_LVALUE =
-            yy_create_buffer( yyin, YY_BUF_SIZE );
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner);
 	}
 
-	yy_init_buffer( YY_CURRENT_BUFFER, input_file );
-	yy_load_buffer_state(  );
+	yy_init_buffer( YY_CURRENT_BUFFER, input_file , yyscanner);
+	yy_load_buffer_state( yyscanner );
 }
 
-/** Switch to a different input buffer.
- * @param new_buffer The new input buffer.
- * 
- */
-    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer )
+    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer , yyscan_t yyscanner)
 {
-    
-	/* TODO. We should be able to replace this entire function body
-	 * with
-	 *		yypop_buffer_state();
-	 *		yypush_buffer_state(new_buffer);
-     */
-	yyensure_buffer_stack ();
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	yyensure_buffer_stack (yyscanner);
 	if ( YY_CURRENT_BUFFER == new_buffer )
 		return;
 
 	if ( YY_CURRENT_BUFFER )
 		{
 		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
 	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-	yy_load_buffer_state(  );
-
-	/* We don't actually know whether we did this switch during
-	 * EOF (yywrap()) processing, but the only time this flag
-	 * is looked at is after yywrap() is called, so it's safe
-	 * to go ahead and always set it.
-	 */
-	(yy_did_buffer_switch_on_eof) = 1;
+	yy_load_buffer_state( yyscanner );
+
+	yyg->yy_did_buffer_switch_on_eof = 1;
 }
 
-static void yy_load_buffer_state  (void)
+static void yy_load_buffer_state  (yyscan_t yyscanner)
 {
-    	(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-	(yytext_ptr) = (yy_c_buf_p) = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+	yyg->yytext_ptr = yyg->yy_c_buf_p = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
 	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
-	(yy_hold_char) = *(yy_c_buf_p);
+	yyg->yy_hold_char = *yyg->yy_c_buf_p;
 }
 
-/** Allocate and initialize an input buffer state.
- * @param file A readable stream.
- * @param size The character buffer size in bytes. When in doubt, use @c YY_BUF_SIZE.
- * 
- * @return the allocated buffer state.
- */
-    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size )
+    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
-    
-	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
+
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state ) , yyscanner );
 	if ( ! b )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
 
 	b->yy_buf_size = size;
 
-	/* yy_ch_buf has to be 2 characters longer than the size given because
-	 * we need to put in 2 end-of-buffer characters.
-	 */
-	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2)  );
+	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2) , yyscanner );
 	if ( ! b->yy_ch_buf )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
 
 	b->yy_is_our_buffer = 1;
 
-	yy_init_buffer( b, file );
+	yy_init_buffer( b, file , yyscanner);
 
 	return b;
 }
 
-/** Destroy the buffer.
- * @param b a buffer created with yy_create_buffer()
- * 
- */
-    void yy_delete_buffer (YY_BUFFER_STATE  b )
+    void yy_delete_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
 {
-    
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
 	if ( ! b )
 		return;
 
@@ -1671,54 +1090,40 @@ static void yy_load_buffer_state  (void)
 		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
 
 	if ( b->yy_is_our_buffer )
-		yyfree( (void *) b->yy_ch_buf  );
+		yyfree( (void *) b->yy_ch_buf , yyscanner );
 
-	yyfree( (void *) b  );
+	yyfree( (void *) b , yyscanner );
 }
 
-/* Initializes or reinitializes a buffer.
- * This function is sometimes called more than once on the same buffer,
- * such as during a yyrestart() or at EOF.
- */
-    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file )
+    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file , yyscan_t yyscanner)
 
 {
 	int oerrno = errno;
-    
-	yy_flush_buffer( b );
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	yy_flush_buffer( b , yyscanner);
 
 	b->yy_input_file = file;
 	b->yy_fill_buffer = 1;
 
-    /* If b is the current buffer, then yy_init_buffer was _probably_
-     * called from yyrestart() or through yy_get_next_buffer.
-     * In that case, we don't want to reset the lineno or column.
-     */
     if (b != YY_CURRENT_BUFFER){
         b->yy_bs_lineno = 1;
         b->yy_bs_column = 0;
     }
 
         b->yy_is_interactive = file ? (isatty( fileno(file) ) > 0) : 0;
-    
+
 	errno = oerrno;
 }
 
-/** Discard all buffered characters. On the next scan, YY_INPUT will be called.
- * @param b the buffer state to be flushed, usually @c YY_CURRENT_BUFFER.
- * 
- */
-    void yy_flush_buffer (YY_BUFFER_STATE  b )
+    void yy_flush_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
 {
-    	if ( ! b )
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if ( ! b )
 		return;
 
 	b->yy_n_chars = 0;
 
-	/* We always need two end-of-buffer characters.  The first causes
-	 * a transition to the end-of-buffer state.  The second causes
-	 * a jam in that state.
-	 */
 	b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
 	b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
 
@@ -1728,124 +1133,96 @@ static void yy_load_buffer_state  (void)
 	b->yy_buffer_status = YY_BUFFER_NEW;
 
 	if ( b == YY_CURRENT_BUFFER )
-		yy_load_buffer_state(  );
+		yy_load_buffer_state( yyscanner );
 }
 
-/** Pushes the new state onto the stack. The new state becomes
- *  the current state. This function will allocate the stack
- *  if necessary.
- *  @param new_buffer The new state.
- *  
- */
-void yypush_buffer_state (YY_BUFFER_STATE new_buffer )
+void yypush_buffer_state (YY_BUFFER_STATE new_buffer , yyscan_t yyscanner)
 {
-    	if (new_buffer == NULL)
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (new_buffer == NULL)
 		return;
 
-	yyensure_buffer_stack();
+	yyensure_buffer_stack(yyscanner);
 
-	/* This block is copied from yy_switch_to_buffer. */
 	if ( YY_CURRENT_BUFFER )
 		{
-		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
-	/* Only push if top exists. Otherwise, replace top. */
 	if (YY_CURRENT_BUFFER)
-		(yy_buffer_stack_top)++;
+		yyg->yy_buffer_stack_top++;
 	YY_CURRENT_BUFFER_LVALUE = new_buffer;
 
-	/* copied from yy_switch_to_buffer. */
-	yy_load_buffer_state(  );
-	(yy_did_buffer_switch_on_eof) = 1;
+	yy_load_buffer_state( yyscanner );
+	yyg->yy_did_buffer_switch_on_eof = 1;
 }
 
-/** Removes and deletes the top of the stack, if present.
- *  The next element becomes the new top.
- *  
- */
-void yypop_buffer_state (void)
+void yypop_buffer_state (yyscan_t yyscanner)
 {
-    	if (!YY_CURRENT_BUFFER)
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (!YY_CURRENT_BUFFER)
 		return;
 
-	yy_delete_buffer(YY_CURRENT_BUFFER );
+	yy_delete_buffer(YY_CURRENT_BUFFER , yyscanner);
 	YY_CURRENT_BUFFER_LVALUE = NULL;
-	if ((yy_buffer_stack_top) > 0)
-		--(yy_buffer_stack_top);
+	if (yyg->yy_buffer_stack_top > 0)
+		--yyg->yy_buffer_stack_top;
 
 	if (YY_CURRENT_BUFFER) {
-		yy_load_buffer_state(  );
-		(yy_did_buffer_switch_on_eof) = 1;
+		yy_load_buffer_state( yyscanner );
+		yyg->yy_did_buffer_switch_on_eof = 1;
 	}
 }
 
-/* Allocates the stack if it does not exist.
- *  Guarantees space for at least one push.
- */
-static void yyensure_buffer_stack (void)
+static void yyensure_buffer_stack (yyscan_t yyscanner)
 {
 	yy_size_t num_to_alloc;
-    
-	if (!(yy_buffer_stack)) {
-
-		/* First allocation is just for 2 elements, since we don't know if this
-		 * scanner will even need a stack. We use 2 instead of 1 to avoid an
-		 * immediate realloc on the next call.
-         */
-      num_to_alloc = 1; /* After all that talk, this was set to 1 anyways... */
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyalloc
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	if (!yyg->yy_buffer_stack) {
+      num_to_alloc = 1;
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)yyalloc
 								(num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
+								, yyscanner);
+		if ( ! yyg->yy_buffer_stack )
 			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
 
-		memset((yy_buffer_stack), 0, num_to_alloc * sizeof(struct yy_buffer_state*));
+		memset(yyg->yy_buffer_stack, 0, num_to_alloc * sizeof(struct yy_buffer_state*));
 
-		(yy_buffer_stack_max) = num_to_alloc;
-		(yy_buffer_stack_top) = 0;
+		yyg->yy_buffer_stack_max = num_to_alloc;
+		yyg->yy_buffer_stack_top = 0;
 		return;
 	}
 
-	if ((yy_buffer_stack_top) >= ((yy_buffer_stack_max)) - 1){
-
-		/* Increase the buffer to prepare for a possible push. */
+	if (yyg->yy_buffer_stack_top >= (yyg->yy_buffer_stack_max) - 1){
 		yy_size_t grow_size = 8 /* arbitrary grow size */;
 
-		num_to_alloc = (yy_buffer_stack_max) + grow_size;
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyrealloc
-								((yy_buffer_stack),
+		num_to_alloc = yyg->yy_buffer_stack_max + grow_size;
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)yyrealloc
+								(yyg->yy_buffer_stack,
 								num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
+								, yyscanner);
+		if ( ! yyg->yy_buffer_stack )
 			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
 
-		/* zero only the new slots.*/
-		memset((yy_buffer_stack) + (yy_buffer_stack_max), 0, grow_size * sizeof(struct yy_buffer_state*));
-		(yy_buffer_stack_max) = num_to_alloc;
+		memset(yyg->yy_buffer_stack + yyg->yy_buffer_stack_max, 0, grow_size * sizeof(struct yy_buffer_state*));
+		yyg->yy_buffer_stack_max = num_to_alloc;
 	}
 }
 
-/** Setup the input buffer state to scan directly from a user-specified character buffer.
- * @param base the character buffer
- * @param size the size in bytes of the character buffer
- * 
- * @return the newly allocated buffer state object.
- */
-YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
+YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
-    
+
 	if ( size < 2 ||
 	     base[size-2] != YY_END_OF_BUFFER_CHAR ||
 	     base[size-1] != YY_END_OF_BUFFER_CHAR )
 		/* They forgot to leave room for the EOB's. */
 		return NULL;
 
-	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state ) , yyscanner );
 	if ( ! b )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
 
@@ -1859,42 +1236,26 @@ YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
 	b->yy_fill_buffer = 0;
 	b->yy_buffer_status = YY_BUFFER_NEW;
 
-	yy_switch_to_buffer( b  );
+	yy_switch_to_buffer( b , yyscanner );
 
 	return b;
 }
 
-/** Setup the input buffer state to scan a string. The next call to yylex() will
- * scan from a @e copy of @a str.
- * @param yystr a NUL-terminated string to scan
- * 
- * @return the newly allocated buffer state object.
- * @note If you want to scan bytes that may contain NUL values, then use
- *       yy_scan_bytes() instead.
- */
-YY_BUFFER_STATE yy_scan_string (const char * yystr )
+YY_BUFFER_STATE yy_scan_string (const char * yystr , yyscan_t yyscanner)
 {
-    
-	return yy_scan_bytes( yystr, (int) strlen(yystr) );
+
+	return yy_scan_bytes( yystr, (int) strlen(yystr) , yyscanner);
 }
 
-/** Setup the input buffer state to scan the given bytes. The next call to yylex() will
- * scan from a @e copy of @a bytes.
- * @param yybytes the byte buffer to scan
- * @param _yybytes_len the number of bytes in the buffer pointed to by @a bytes.
- * 
- * @return the newly allocated buffer state object.
- */
-YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, yy_size_t  _yybytes_len )
+YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
 	char *buf;
 	yy_size_t n;
-	yy_size_t i;
-    
-	/* Get memory for full buffer, including space for trailing EOB's. */
+	int i;
+
 	n = (yy_size_t) (_yybytes_len + 2);
-	buf = (char *) yyalloc( n  );
+	buf = (char *) yyalloc( n , yyscanner );
 	if ( ! buf )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
 
@@ -1903,13 +1264,10 @@ YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, yy_size_t  _yybytes_len )
 
 	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
 
-	b = yy_scan_buffer( buf, n );
+	b = yy_scan_buffer( buf, n , yyscanner);
 	if ( ! b )
 		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
 
-	/* It's okay to grow etc. this buffer, and we should throw it
-	 * away when we're done.
-	 */
 	b->yy_is_our_buffer = 1;
 
 	return b;
@@ -1919,9 +1277,11 @@ YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, yy_size_t  _yybytes_len )
 #define YY_EXIT_FAILURE 2
 #endif
 
-static void yynoreturn yy_fatal_error (const char* msg )
+static void yynoreturn yy_fatal_error (const char* msg , yyscan_t yyscanner)
 {
-			fprintf( stderr, "%s\n", msg );
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	fprintf( stderr, "%s\n", msg );
 	exit( YY_EXIT_FAILURE );
 }
 
@@ -1932,198 +1292,529 @@ static void yynoreturn yy_fatal_error (const char* msg )
 	do \
 		{ \
 		/* Undo effects of setting up yytext. */ \
-        yy_size_t yyless_macro_arg = (n); \
+        int yyless_macro_arg = (n); \
         YY_LESS_LINENO(yyless_macro_arg);\
-		yytext[yyleng] = (yy_hold_char); \
-		(yy_c_buf_p) = yytext + yyless_macro_arg; \
-		(yy_hold_char) = *(yy_c_buf_p); \
-		*(yy_c_buf_p) = '\0'; \
+		yytext[yyleng] = yyg->yy_hold_char; \
+		yyg->yy_c_buf_p = yytext + yyless_macro_arg; \
+		yyg->yy_hold_char = *yyg->yy_c_buf_p; \
+		*yyg->yy_c_buf_p = '\0'; \
 		yyleng = yyless_macro_arg; \
 		} \
 	while ( 0 )
 
-/* Accessor  methods (get/set functions) to struct members. */
+YY_EXTRA_TYPE yyget_extra  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyextra;
+}
 
-/** Get the current line number.
- * 
- */
-int yyget_lineno  (void)
+int yyget_lineno  (yyscan_t yyscanner)
 {
-    
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+
     return yylineno;
 }
 
-/** Get the input stream.
- * 
- */
-FILE *yyget_in  (void)
+int yyget_column  (yyscan_t yyscanner)
 {
-        return yyin;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+
+    return yycolumn;
 }
 
-/** Get the output stream.
- * 
- */
-FILE *yyget_out  (void)
+FILE *yyget_in  (yyscan_t yyscanner)
 {
-        return yyout;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyin;
 }
 
-/** Get the length of the current token.
- * 
- */
-yy_size_t yyget_leng  (void)
+FILE *yyget_out  (yyscan_t yyscanner)
 {
-        return yyleng;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyout;
 }
 
-/** Get the current token.
- * 
- */
+int yyget_leng  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyleng;
+}
 
-char *yyget_text  (void)
+char *yyget_text  (yyscan_t yyscanner)
 {
-        return yytext;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yytext;
 }
 
-/** Set the current line number.
- * @param _line_number line number
- * 
- */
-void yyset_lineno (int  _line_number )
+void yyset_extra (YY_EXTRA_TYPE  user_defined , yyscan_t yyscanner)
 {
-    
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyextra = user_defined ;
+}
+
+void yyset_lineno (int  _line_number , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER )
+           YY_FATAL_ERROR( "yyset_lineno called with no buffer" );
+
     yylineno = _line_number;
 }
 
-/** Set the input stream. This does not discard the current
- * input buffer.
- * @param _in_str A readable stream.
- * 
- * @see yy_switch_to_buffer
- */
-void yyset_in (FILE *  _in_str )
+void yyset_column (int  _column_no , yyscan_t yyscanner)
 {
-        yyin = _in_str ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER )
+           YY_FATAL_ERROR( "yyset_column called with no buffer" );
+
+    yycolumn = _column_no;
 }
 
-void yyset_out (FILE *  _out_str )
+void yyset_in (FILE *  _in_str , yyscan_t yyscanner)
 {
-        yyout = _out_str ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyin = _in_str ;
 }
 
-int yyget_debug  (void)
+void yyset_out (FILE *  _out_str , yyscan_t yyscanner)
 {
-        return yy_flex_debug;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyout = _out_str ;
 }
 
-void yyset_debug (int  _bdebug )
+int yyget_debug  (yyscan_t yyscanner)
 {
-        yy_flex_debug = _bdebug ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yy_flex_debug;
 }
 
-static int yy_init_globals (void)
+void yyset_debug (int  _bdebug , yyscan_t yyscanner)
 {
-        /* Initialization is the same as for the non-reentrant scanner.
-     * This function is called from yylex_destroy(), so don't allocate here.
-     */
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yy_flex_debug = _bdebug ;
+}
+
+int yylex_init(yyscan_t* ptr_yy_globals)
+{
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) yyalloc ( sizeof( struct yyguts_t ), NULL );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    return yy_init_globals ( *ptr_yy_globals );
+}
+
+int yylex_init_extra( YY_EXTRA_TYPE yy_user_defined, yyscan_t* ptr_yy_globals )
+{
+    struct yyguts_t dummy_yyguts;
+
+    yyset_extra (yy_user_defined, &dummy_yyguts);
+
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) yyalloc ( sizeof( struct yyguts_t ), &dummy_yyguts );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    yyset_extra (yy_user_defined, *ptr_yy_globals);
+
+    return yy_init_globals ( *ptr_yy_globals );
+}
+
+static int yy_init_globals (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+    yyg->yy_buffer_stack = NULL;
+    yyg->yy_buffer_stack_top = 0;
+    yyg->yy_buffer_stack_max = 0;
+    yyg->yy_c_buf_p = NULL;
+    yyg->yy_init = 0;
+    yyg->yy_start = 0;
+
+    yyg->yy_start_stack_ptr = 0;
+    yyg->yy_start_stack_depth = 0;
+    yyg->yy_start_stack =  NULL;
 
-    /* We do not touch yylineno unless the option is enabled. */
-    yylineno =  1;
-    
-    (yy_buffer_stack) = NULL;
-    (yy_buffer_stack_top) = 0;
-    (yy_buffer_stack_max) = 0;
-    (yy_c_buf_p) = NULL;
-    (yy_init) = 0;
-    (yy_start) = 0;
-
-/* Defined in main.c */
-#ifdef YY_STDINIT
-    yyin = stdin;
-    yyout = stdout;
-#else
     yyin = NULL;
     yyout = NULL;
-#endif
 
-    /* For future reference: Set errno on error, since we are called by
-     * yylex_init()
-     */
     return 0;
 }
 
-/* yylex_destroy is for both reentrant and non-reentrant scanners. */
-int yylex_destroy  (void)
+int yylex_destroy  (yyscan_t yyscanner)
 {
-    
-    /* Pop the buffer stack, destroying each element. */
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
 	while(YY_CURRENT_BUFFER){
-		yy_delete_buffer( YY_CURRENT_BUFFER  );
+		yy_delete_buffer( YY_CURRENT_BUFFER , yyscanner );
 		YY_CURRENT_BUFFER_LVALUE = NULL;
-		yypop_buffer_state();
+		yypop_buffer_state(yyscanner);
 	}
 
-	/* Destroy the stack itself. */
-	yyfree((yy_buffer_stack) );
-	(yy_buffer_stack) = NULL;
+	yyfree(yyg->yy_buffer_stack , yyscanner);
+	yyg->yy_buffer_stack = NULL;
+
+    yyfree( yyg->yy_start_stack , yyscanner );
+    yyg->yy_start_stack = NULL;
 
-    /* Reset the globals. This is important in a non-reentrant scanner so the next time
-     * yylex() is called, initialization will occur. */
-    yy_init_globals( );
+    yy_init_globals( yyscanner);
 
+    yyfree ( yyscanner , yyscanner );
+    yyscanner = NULL;
     return 0;
 }
 
+void *yyalloc (yy_size_t  size , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	return malloc(size);
+}
+
+void *yyrealloc  (void * ptr, yy_size_t  size , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	return realloc(ptr, size);
+}
+
+void yyfree (void * ptr , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
+}
+
+#define YYTABLES_NAME "yytables"
+
+#line 150 "cool.l"
+
+_Static_assert(YY_NUM_RULES < LEXPROF_MAX_RULES, "LEXPROF_MAX_RULES is too small");
+
 /*
- * Internal utility routines.
+ * 문자열 상수의 내용을 정한다. 이스케이프가 없으면 입력 버퍼를 그대로 가리키고,
+ * 있으면 해석한 결과를 아레나에 만든다. 스트림 입력은 flex 버퍼가 곧 덮어써지므로
+ * 이스케이프가 없어도 아레나에 복사한다.
  */
-
-#ifndef yytext_ptr
-static void yy_flex_strncpy (char* s1, const char * s2, int n )
+static void set_string(cool_lexer_t *lx, const char *s, size_t len)
 {
-		
-	int i;
-	for ( i = 0; i < n; ++i )
-		s1[i] = s2[i];
+    const char *end = s + len;
+    char *d;
+
+    if (lx->buf && !memchr(s, '\\', len)) {
+        lx->str = s;
+        lx->str_len = len;
+        return;
+    }
+    lx->str = d = arena_bytes(&lx->strings, len);
+    while (s < end) {
+        if (*s != '\\') {
+            *d++ = *s++;
+            continue;
+        }
+        switch (s[1]) {
+        case 'b': *d++ = '\b'; break;
+        case 't': *d++ = '\t'; break;
+        case 'n': *d++ = '\n'; break;
+        case 'f': *d++ = '\f'; break;
+        default:  *d++ = s[1]; break;   /* \" 와 \\ */
+        }
+        s += 2;
+    }
+    lx->str_len = (size_t)(d - lx->str);
 }
+
+/*
+ * 숫자 여덟 개(s[0]이 가장 높은 자리)를 한 번에 변환한다. 8바이트를 리틀 엔디안으로 읽어
+ * 각 바이트를 숫자 값으로 바꾼 뒤, 이웃한 두 자리, 네 자리씩 곱해 더하며 합친다.
+ */
+static uint32_t eight_digits(const char *s)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint64_t v;
+
+    memcpy(&v, s, sizeof(v));
+    v -= 0x3030303030303030ULL;
+    v = v * 10 + (v >> 8);
+    v = ((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)) +
+         ((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32))) >> 32;
+    return (uint32_t)v;
+#else
+    uint32_t v = 0;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        v = v * 10 + (uint32_t)(s[i] - '0');
+    return v;
 #endif
+}
 
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen (const char * s )
+/*
+ * 숫자 len개로 된 정수 상수 s의 값을 구한다. 앞의 0을 건너뛴 뒤 여덟 자리씩 변환한다.
+ * 값이 COOL의 Int(32비트 부호 있는 정수) 범위를 넘으면 -1을 돌려준다.
+ */
+static int int_value(const char *s, size_t len, int *value)
 {
-	int n;
-	for ( n = 0; s[n]; ++n )
-		;
+    uint64_t v = 0;
 
-	return n;
+    while (len > 0 && *s == '0') {
+        s++;
+        len--;
+    }
+    if (len > 10)
+        return -1;
+    if (len >= 8) {
+        v = eight_digits(s);
+        s += 8;
+        len -= 8;
+    }
+    while (len > 0) {
+        v = v * 10 + (uint64_t)(*s++ - '0');
+        len--;
+    }
+    if (v > INT32_MAX)
+        return -1;
+    *value = (int)v;
+    return 0;
 }
-#endif
 
-void *yyalloc (yy_size_t  size )
+/* 스캐너 인스턴스를 만든다 */
+static cool_lexer_t *lexer_new(void)
 {
-			return malloc(size);
+    cool_lexer_t *lx = calloc(1, sizeof(cool_lexer_t));
+
+    if (!lx)
+        return NULL;
+    lineidx_init(&lx->lines, 0, 1);
+    pthread_mutex_init(&lx->lines_lock, NULL);
+    arena_init(&lx->strings);
+    if (yylex_init_extra(lx, &lx->scanner) != 0) {
+        free(lx);
+        return NULL;
+    }
+    LEXPROF_OPEN(&lx->prof, ((const char *[]){ "INITIAL", "COMMENT", "S_LINE_COMMENT" }), 3);
+    return lx;
 }
 
-void *yyrealloc  (void * ptr, yy_size_t  size )
+/*
+ * 일반 파일을 mmap으로 매핑하여 flex 버퍼로 직접 스캔한다.
+ * yy_scan_buffer()는 버퍼 끝에 YY_END_OF_BUFFER_CHAR 두 개를 요구하므로
+ * 파일보다 두 바이트 이상 큰 익명 영역을 먼저 잡고 그 위에 파일을 겹쳐 매핑한다.
+ * flex는 yytext를 만들 때 버퍼에 '\0'을 쓰기 때문에 MAP_PRIVATE로 쓰기를 허용한다.
+ * 매핑할 수 없으면(파이프, 표준입력, 빈 파일 등) 0을 돌려주고 기존 스트림 방식을 쓴다.
+ * flex는 버퍼 크기를 int로 다루므로 그보다 큰 파일도 스트림 방식으로 읽는다.
+ */
+static int map_input(cool_lexer_t *lx, int fd)
 {
-		
-	/* The cast to (char *) in the following accommodates both
-	 * implementations that use char* generic pointers, and those
-	 * that use void* generic pointers.  It works with the latter
-	 * because both ANSI C and C++ allow castless assignment from
-	 * any pointer type to void*, and deal with argument conversions
-	 * as though doing an assignment.
-	 */
-	return realloc(ptr, size);
+    struct stat st;
+    size_t size, len;
+    long page;
+    char *base;
+
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size == 0)
+        return 0;
+    size = (size_t)st.st_size;
+    if (size > (size_t)INT_MAX - 2)
+        return 0;
+    page = sysconf(_SC_PAGESIZE);
+    len = (size + 2 + page - 1) / page * page;
+    base = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return 0;
+    if (mmap(base, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(base, len);
+        return 0;
+    }
+    madvise(base, len, MADV_SEQUENTIAL);
+    /* 파일 끝 이후의 바이트는 0으로 채워져 있으므로 그대로 센티널이 된다 */
+    if (!yy_scan_buffer(base, size + 2, lx->scanner)) {
+        munmap(base, len);
+        return 0;
+    }
+    lx->buf = base;
+    lx->buf_len = len;
+    lx->mapped = 1;
+    return 1;
 }
 
-void yyfree (void * ptr )
+/*
+ * 메모리에 있는 소스를 스캔한다. flex가 버퍼에 쓰기 때문에 센티널을 붙인 복사본을 만든다.
+ */
+cool_lexer_t *cool_lexer_open_buffer(const char *buf, size_t len)
 {
-			free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
+    cool_lexer_t *lx = lexer_new();
+
+    if (!lx)
+        return NULL;
+    if (len > (size_t)INT_MAX - 2 || !(lx->buf = malloc(len + 2))) {
+        cool_lexer_close(lx);
+        return NULL;
+    }
+    memcpy(lx->buf, buf, len);
+    lx->buf[len] = lx->buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+    lx->buf_len = len + 2;
+    if (!yy_scan_buffer(lx->buf, len + 2, lx->scanner)) {
+        cool_lexer_close(lx);
+        return NULL;
+    }
+    return lx;
 }
 
-#define YYTABLES_NAME "yytables"
+/*
+ * 입력 파일을 연다. 일반 파일은 mmap 경로를, 그 밖에는 스트림 경로를 사용한다.
+ * 파일을 열 수 없으면 NULL을 돌려준다.
+ */
+cool_lexer_t *cool_lexer_open_file(const char *path)
+{
+    cool_lexer_t *lx;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return NULL;
+    if (!(lx = lexer_new())) {
+        close(fd);
+        return NULL;
+    }
+    if (map_input(lx, fd)) {
+        close(fd);
+        return lx;
+    }
+    if (!(lx->fp = fdopen(fd, "r"))) {
+        close(fd);
+        cool_lexer_close(lx);
+        return NULL;
+    }
+    yyset_in(lx->fp, lx->scanner);
+    return lx;
+}
 
-#line 100 "cool.l"
+/* 이미 열려 있는 스트림(예: 표준입력)을 스캔한다. 스트림은 닫지 않는다 */
+cool_lexer_t *cool_lexer_open_stream(FILE *fp)
+{
+    cool_lexer_t *lx = lexer_new();
 
+    if (lx)
+        yyset_in(fp, lx->scanner);
+    return lx;
+}
+
+/*
+ * 입력이 도착하는 대로 cool_lexer_feed()로 구간씩 넘겨받아 스캔하는 인스턴스를 만든다.
+ * 스트림 입력처럼 문자열 상수는 아레나에 복사하고 줄바꿈은 받는 즉시 색인한다.
+ */
+cool_lexer_t *cool_lexer_open_push(void)
+{
+    return lexer_new();
+}
+
+/*
+ * 다음 구간 buf를 넘긴다. cool_lexer_next()가 0을 돌려줄 때까지 이 구간의 토큰을 읽은 뒤
+ * 다음 구간을 넘긴다. 시작 조건(주석 안 등)과 오프셋은 구간을 넘어 이어지지만 렉심은
+ * 이어지지 않으므로, 구간은 줄바꿈 바로 뒤나 입력 끝에서 나눈다. 이 스캐너에서 줄바꿈을
+ * 넘는 렉심은 공백뿐이라 나누어 인식해도 같다. 이전 구간과 그 토큰의 text는 이때 해제된다.
+ */
+int cool_lexer_feed(cool_lexer_t *lx, const char *buf, size_t len)
+{
+    char *chunk = malloc(len + 2);
+
+    if (!chunk)
+        return -1;
+    memcpy(chunk, buf, len);
+    chunk[len] = chunk[len + 1] = YY_END_OF_BUFFER_CHAR;
+    if (lineidx_add(&lx->lines, chunk, len) < 0) {
+        free(chunk);
+        return -1;
+    }
+    yypop_buffer_state(lx->scanner);
+    if (!yy_scan_buffer(chunk, len + 2, lx->scanner)) {
+        free(chunk);
+        return -1;
+    }
+    free(lx->chunk);
+    lx->chunk = chunk;
+    return 0;
+}
+
+/*
+ * 다음 토큰을 인식하여 tok에 채운다. 토큰 값을 돌려주며 입력의 끝이면 0이다.
+ */
+int cool_lexer_next(cool_lexer_t *lx, cool_token_t *tok)
+{
+    int kind = cool_yylex(lx->scanner);
+
+    if (tok) {
+        tok->kind = kind;
+        tok->offset = kind ? lx->tokenOffset : lx->nextOffset;
+        tok->text = kind ? yyget_text(lx->scanner) : "";
+        tok->len = kind ? (size_t)yyget_leng(lx->scanner) : 0;
+        tok->name = kind == TYPE || kind == ID ? intern(tok->text, tok->len) : NULL;
+        tok->str = kind == STRING ? lx->str : NULL;
+        tok->str_len = kind == STRING ? lx->str_len : 0;
+        tok->value = kind == INTEGER ? lx->value : 0;
+    }
+    return kind;
+}
+
+/*
+ * offset이 있는 줄번호를 돌려준다. 버퍼 입력은 아직 색인하지 않은 구간을 이때 색인한다.
+ * offset은 이미 스캔한 위치여야 하며, 파이프라인에서는 파서 스레드도 부르므로 잠근다.
+ */
+int cool_lexer_line(cool_lexer_t *lx, size_t offset)
+{
+    lineidx_t *ix = &lx->lines;
+    int line;
+
+    pthread_mutex_lock(&lx->lines_lock);
+    if (lx->buf && offset > ix->end && lineidx_add(ix, lx->buf + ix->end, offset - ix->end) < 0) {
+        perror("cool_parser");
+        exit(1);
+    }
+    line = lineidx_line(ix, offset);
+    pthread_mutex_unlock(&lx->lines_lock);
+    return line;
+}
+
+void cool_lexer_close(cool_lexer_t *lx)
+{
+    if (!lx)
+        return;
+    LEXPROF_CLOSE(&lx->prof);
+    yylex_destroy(lx->scanner);
+    if (lx->mapped)
+        munmap(lx->buf, lx->buf_len);
+    else
+        free(lx->buf);
+    if (lx->fp)
+        fclose(lx->fp);
+    free(lx->chunk);
+    arena_release(&lx->strings);
+    lineidx_free(&lx->lines);
+    pthread_mutex_destroy(&lx->lines_lock);
+    free(lx);
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#include "lexprof.h"
+
+#ifdef COOL_LEX_PROFILE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+/*
+ * 닫힌 스캐너들의 합계와 아직 열려 있는 스캐너의 목록.
+ * 여러 스레드가 스캐너를 열고 닫으므로 잠그고 고친다.
+ */
+static lexprof_t total;
+static lexprof_t *live;
+static const char *stateName[LEXPROF_MAX_STATES];
+static int nstate;
+static int registered;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+uint64_t lexprof_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* 규칙 rule이 처음 인식한 렉심을 표에 보일 수 있도록 제어 문자를 바꾸어 남긴다 */
+void lexprof_sample(lexprof_t *p, int rule, const char *text, size_t len)
+{
+    char *s = p->sample[rule];
+    size_t i, n = 0;
+
+    for (i = 0; i < len && n + 2 < sizeof(p->sample[rule]); i++) {
+        unsigned char c = (unsigned char)text[i];
+        if (c == '\n' || c == '\t') {
+            s[n++] = '\\';
+            s[n++] = c == '\n' ? 'n' : 't';
+        } else
+            s[n++] = c < 0x20 || c == 0x7f ? '?' : (char)c;
+    }
+    s[n] = '\0';
+}
+
+/* 스캐너 하나의 프로파일을 합계에 더한다. lock을 잡고 부른다 */
+static void add(const lexprof_t *p)
+{
+    int i;
+
+    for (i = 0; i < LEXPROF_MAX_RULES; i++) {
+        if (p->matches[i] && !total.matches[i])
+            memcpy(total.sample[i], p->sample[i], sizeof(total.sample[i]));
+        total.matches[i] += p->matches[i];
+        total.bytes[i] += p->bytes[i];
+    }
+    for (i = 0; i < nstate; i++)
+        total.ns[i] += p->ns[i];
+}
+
+/*
+ * 합계를 표로 출력한다. 인식한 적이 없는 규칙은 생략한다.
+ * 오류로 exit()한 경우처럼 닫지 않은 스캐너가 남아 있으면 그 값도 더한다.
+ * 다른 스레드가 스캔하는 중이면 그 스캐너의 값은 조금 어긋날 수 있다.
+ */
+static void report(void)
+{
+    uint64_t bytes = 0, ns = 0;
+    lexprof_t *p;
+    int i;
+
+    pthread_mutex_lock(&lock);
+    for (p = live; p; p = p->next)
+        add(p);
+    live = NULL;
+    for (i = 0; i < LEXPROF_MAX_RULES; i++)
+        bytes += total.bytes[i];
+    for (i = 0; i < nstate; i++)
+        ns += total.ns[i];
+    fprintf(stderr, "%6s %14s %14s %7s  %s\n", "rule", "matches", "bytes", "bytes%", "sample");
+    for (i = 0; i < LEXPROF_MAX_RULES; i++)
+        if (total.matches[i])
+            fprintf(stderr, "%6d %14llu %14llu %6.2f%%  %s\n", i,
+                    (unsigned long long)total.matches[i], (unsigned long long)total.bytes[i],
+                    bytes ? 100.0 * total.bytes[i] / bytes : 0.0, total.sample[i]);
+    fprintf(stderr, "\n%-16s %12s %7s\n", "start condition", "seconds", "time%");
+    for (i = 0; i < nstate; i++)
+        fprintf(stderr, "%-16s %12.6f %6.2f%%\n", stateName[i], total.ns[i] / 1e9,
+                ns ? 100.0 * total.ns[i] / ns : 0.0);
+    pthread_mutex_unlock(&lock);
+}
+
+/*
+ * 새 스캐너의 프로파일 p를 열린 목록에 넣는다. 처음 부를 때 프로그램이 끝나면 표를
+ * 출력하도록 등록한다. states는 시작 조건 번호 순서의 이름(문자열 상수)이다.
+ */
+void lexprof_open(lexprof_t *p, const char *const *states, int nstates)
+{
+    int i;
+
+    pthread_mutex_lock(&lock);
+    if (!registered) {
+        registered = 1;
+        nstate = nstates < LEXPROF_MAX_STATES ? nstates : LEXPROF_MAX_STATES;
+        for (i = 0; i < nstate; i++)
+            stateName[i] = states[i];
+        atexit(report);
+    }
+    p->prev = NULL;
+    p->next = live;
+    if (live)
+        live->prev = p;
+    live = p;
+    pthread_mutex_unlock(&lock);
+}
+
+/* 닫는 스캐너의 프로파일 p를 열린 목록에서 빼고 합계에 더한다 */
+void lexprof_merge(lexprof_t *p)
+{
+    pthread_mutex_lock(&lock);
+    if (p->prev)
+        p->prev->next = p->next;
+    else
+        live = p->next;
+    if (p->next)
+        p->next->prev = p->prev;
+    add(p);
+    pthread_mutex_unlock(&lock);
+}
+#endif
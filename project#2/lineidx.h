@@ -0,0 +1,38 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 줄바꿈 색인.
+ *
+ * 스캐너는 줄을 세지 않고 토큰의 바이트 오프셋만 기록한다. 줄번호가 필요할 때
+ * 아직 색인하지 않은 구간을 벡터 명령으로 한 번 훑어 줄바꿈 위치를 모아 두고,
+ * 오프셋 앞에 있는 줄바꿈의 수를 이진 탐색으로 구한다. 토큰 순서대로 조회하면
+ * 직전 조회 위치부터 찾으므로 덤프처럼 모든 토큰의 줄번호를 구해도 싸다.
+ */
+#ifndef LINEIDX_H
+#define LINEIDX_H
+
+#include <stddef.h>
+
+typedef struct lineidx {
+    size_t base;            /* 색인이 시작하는 오프셋 */
+    int base_line;          /* base의 줄번호 */
+    size_t end;             /* 색인한 구간 [base, end)의 끝 */
+    size_t *nl;             /* 구간 안의 줄바꿈 오프셋(오름차순) */
+    size_t n;
+    size_t cap;
+    size_t hint;            /* 직전 조회에서 구한 줄바꿈의 수 */
+} lineidx_t;
+
+/* 함수 프로토타입 선언 */
+void lineidx_init(lineidx_t *ix, size_t base, int line);
+int lineidx_add(lineidx_t *ix, const char *p, size_t len);
+int lineidx_line(lineidx_t *ix, size_t offset);
+size_t lineidx_column(lineidx_t *ix, size_t offset);
+void lineidx_free(lineidx_t *ix);
+
+#endif // LINEIDX_H
@@ -7,203 +7,200 @@
  */
 #include "node.h"
 #include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-
-/* 안전한 문자열 복제 */
-char *strdup_safe(const char *src) {
-    if (!src) return NULL;
-    char *dup = malloc(strlen(src) + 1);
-    if (!dup) return NULL;
-    strcpy(dup, src);
-    return dup;
-}
 
 /* 클래스 리스트 생성 및 추가 */
-class_list_t *create_class_list(class_t *class) {
-    class_list_t *list = malloc(sizeof(class_list_t));
-    if (!list) return NULL;
+class_list_t *create_class_list(arena_t *a, class_t *class) {
+    class_list_t *list = arena_alloc(a, sizeof(class_list_t));
     list->class = class;
-    list->next = NULL;
+    list->next = list;
     return list;
 }
 
-class_list_t *append_class_list(class_list_t *list, class_t *class) {
-    if (!list) return create_class_list(class);
-    class_list_t *current = list;
-    while (current->next) current = current->next;
-    current->next = create_class_list(class);
-    return list;
+class_list_t *append_class_list(arena_t *a, class_list_t *list, class_t *class) {
+    if (!list) return create_class_list(a, class);
+    class_list_t *node = create_class_list(a, class);
+    node->next = list->next;
+    list->next = node;
+    return node;
+}
+
+class_list_t *finish_class_list(class_list_t *list) {
+    if (!list) return NULL;
+    class_list_t *head = list->next;
+    list->next = NULL;
+    return head;
 }
 
 /* 클래스 생성 */
-class_t *create_class(char *type, char *inherited, feature_list_t *features) {
-    class_t *new_class = malloc(sizeof(class_t));
-    if (!new_class) return NULL;
-    new_class->type = strdup_safe(type);
-    new_class->inherited = inherited ? strdup_safe(inherited) : NULL;
+class_t *create_class(arena_t *a, const char *type, const char *inherited, feature_list_t *features) {
+    class_t *new_class = arena_alloc(a, sizeof(class_t));
+    new_class->type = type;
+    new_class->inherited = inherited;
     new_class->features = features;
     return new_class;
 }
 
 /* Feature 리스트 생성 및 추가 */
-feature_list_t *create_feature_list(feature_t *feature) {
-    feature_list_t *list = malloc(sizeof(feature_list_t));
-    if (!list) return NULL;
+feature_list_t *create_feature_list(arena_t *a, feature_t *feature) {
+    feature_list_t *list = arena_alloc(a, sizeof(feature_list_t));
     list->feature = feature;
-    list->next = NULL;
+    list->next = list;
     return list;
 }
 
-feature_list_t *append_feature_list(feature_list_t *list, feature_t *feature) {
-    if (!list) return create_feature_list(feature);
-    feature_list_t *current = list;
-    while (current->next) current = current->next;
-    current->next = create_feature_list(feature);
-    return list;
+feature_list_t *append_feature_list(arena_t *a, feature_list_t *list, feature_t *feature) {
+    if (!list) return create_feature_list(a, feature);
+    feature_list_t *node = create_feature_list(a, feature);
+    node->next = list->next;
+    list->next = node;
+    return node;
+}
+
+feature_list_t *finish_feature_list(feature_list_t *list) {
+    if (!list) return NULL;
+    feature_list_t *head = list->next;
+    list->next = NULL;
+    return head;
 }
 
 /* Feature 생성 */
-feature_t *create_attribute(char *name, char *type, expr_t *init) {
-    feature_t *attribute = malloc(sizeof(feature_t));
-    if (!attribute) return NULL;
-    attribute->name = strdup_safe(name);
-    attribute->type = strdup_safe(type);
+feature_t *create_attribute(arena_t *a, const char *name, const char *type, expr_t *init) {
+    feature_t *attribute = arena_alloc(a, sizeof(feature_t));
+    attribute->name = name;
+    attribute->type = type;
     attribute->formals = NULL;
     attribute->body = init;
     return attribute;
 }
 
-feature_t *create_method(char *name, formal_list_t *formals, char *type, expr_t *body) {
-    feature_t *method = malloc(sizeof(feature_t));
-    if (!method) return NULL;
-    method->name = strdup_safe(name);
-    method->type = strdup_safe(type);
+feature_t *create_method(arena_t *a, const char *name, formal_list_t *formals, const char *type, expr_t *body) {
+    feature_t *method = arena_alloc(a, sizeof(feature_t));
+    method->name = name;
+    method->type = type;
     method->formals = formals;
     method->body = body;
     return method;
 }
 
 /* 표현식 리스트 생성 및 추가 */
-expr_list_t *create_expr_list(expr_t *expr) {
-    expr_list_t *list = malloc(sizeof(expr_list_t));
-    if (!list) return NULL;
+expr_list_t *create_expr_list(arena_t *a, expr_t *expr) {
+    expr_list_t *list = arena_alloc(a, sizeof(expr_list_t));
     list->expr = expr;
-    list->next = NULL;
+    list->next = list;
     return list;
 }
 
-expr_list_t *append_expr_list(expr_list_t *list, expr_t *expr) {
-    expr_list_t *node = malloc(sizeof(expr_list_t));
-    if (!node) return NULL;
-    node->expr = expr;
-    node->next = NULL;
-    if (!list) return node;
-    expr_list_t *current = list;
-    while (current->next) current = current->next;
-    current->next = node;
-    return list;
+expr_list_t *append_expr_list(arena_t *a, expr_list_t *list, expr_t *expr) {
+    if (!list) return create_expr_list(a, expr);
+    expr_list_t *node = create_expr_list(a, expr);
+    node->next = list->next;
+    list->next = node;
+    return node;
 }
 
-/* Formal 리스트 생성 및 추가 */
-formal_list_t *create_formal_list(formal_t *formal) {
-    formal_list_t *list = malloc(sizeof(formal_list_t));
+expr_list_t *finish_expr_list(expr_list_t *list) {
     if (!list) return NULL;
-    list->formal = formal;
+    expr_list_t *head = list->next;
     list->next = NULL;
-    return list;
+    return head;
 }
 
-formal_list_t *append_formal_list(formal_list_t *list, formal_t *formal) {
-    formal_list_t *node = malloc(sizeof(formal_list_t));
-    if (!node) return NULL;
-    node->formal = formal;
-    node->next = NULL;
-    if (!list) return node;
-    formal_list_t *current = list;
-    while (current->next) current = current->next;
-    current->next = node;
+/* Formal 리스트 생성 및 추가 */
+formal_list_t *create_formal_list(arena_t *a, formal_t *formal) {
+    formal_list_t *list = arena_alloc(a, sizeof(formal_list_t));
+    list->formal = formal;
+    list->next = list;
     return list;
 }
 
+formal_list_t *append_formal_list(arena_t *a, formal_list_t *list, formal_t *formal) {
+    if (!list) return create_formal_list(a, formal);
+    formal_list_t *node = create_formal_list(a, formal);
+    node->next = list->next;
+    list->next = node;
+    return node;
+}
+
+formal_list_t *finish_formal_list(formal_list_t *list) {
+    if (!list) return NULL;
+    formal_list_t *head = list->next;
+    list->next = NULL;
+    return head;
+}
+
 /* Formal 생성 */
-formal_t *create_formal(char *name, char *type) {
-    formal_t *formal = malloc(sizeof(formal_t));
-    if (!formal) return NULL;
-    formal->name = strdup_safe(name);
-    formal->type = strdup_safe(type);
+formal_t *create_formal(arena_t *a, const char *name, const char *type) {
+    formal_t *formal = arena_alloc(a, sizeof(formal_t));
+    formal->name = name;
+    formal->type = type;
     return formal;
 }
 
 /* Case 리스트 생성 및 추가 */
-case_list_t *create_case_list(case_t *new_case) {
-    case_list_t *list = malloc(sizeof(case_list_t));
-    if (!list) return NULL;
+case_list_t *create_case_list(arena_t *a, case_t *new_case) {
+    case_list_t *list = arena_alloc(a, sizeof(case_list_t));
     list->case_expr = new_case;
-    list->next = NULL;
+    list->next = list;
     return list;
 }
 
-case_list_t *append_case_list(case_list_t *list, case_t *new_case) {
-    case_list_t *node = malloc(sizeof(case_list_t));
-    if (!node) return NULL;
-    node->case_expr = new_case;
-    node->next = NULL;
-    if (!list) return node;
-    case_list_t *current = list;
-    while (current->next) current = current->next;
-    current->next = node;
-    return list;
+case_list_t *append_case_list(arena_t *a, case_list_t *list, case_t *new_case) {
+    if (!list) return create_case_list(a, new_case);
+    case_list_t *node = create_case_list(a, new_case);
+    node->next = list->next;
+    list->next = node;
+    return node;
+}
+
+case_list_t *finish_case_list(case_list_t *list) {
+    if (!list) return NULL;
+    case_list_t *head = list->next;
+    list->next = NULL;
+    return head;
 }
 
 /* Case 생성 */
-case_t *create_case(char *id, char *type, expr_t *expr) {
-    case_t *new_case = malloc(sizeof(case_t));
-    if (!new_case) return NULL;
-    new_case->id = strdup_safe(id);
-    new_case->type = strdup_safe(type);
+case_t *create_case(arena_t *a, const char *id, const char *type, expr_t *expr) {
+    case_t *new_case = arena_alloc(a, sizeof(case_t));
+    new_case->id = id;
+    new_case->type = type;
     new_case->expr = expr;
     return new_case;
 }
 
 /* 표현식 생성 */
-expr_t *create_assign_expr(char *id, expr_t *expr) {
-    expr_t *assignment = malloc(sizeof(expr_t));
-    if (!assignment) return NULL;
+expr_t *create_assign_expr(arena_t *a, const char *id, expr_t *expr) {
+    expr_t *assignment = arena_alloc(a, sizeof(expr_t));
     assignment->type = ASSIGN_EXPR;
-    assignment->assign_expr.id = strdup_safe(id);
+    assignment->assign_expr.id = id;
     assignment->assign_expr.expr = expr;
     return assignment;
 }
 
-expr_t *create_block_expr(expr_list_t *block) {
-    expr_t *expr = malloc(sizeof(expr_t));
-    if (!expr) return NULL;
+expr_t *create_block_expr(arena_t *a, expr_list_t *block) {
+    expr_t *expr = arena_alloc(a, sizeof(expr_t));
     expr->type = BLOCK_EXPR;
     expr->block_expr.block_expr = block;
     return expr;
 }
 
-expr_t *create_bool_expr(bool value) {
-    expr_t *expr = malloc(sizeof(expr_t));
-    if (!expr) return NULL;
+expr_t *create_bool_expr(arena_t *a, bool value) {
+    expr_t *expr = arena_alloc(a, sizeof(expr_t));
     expr->type = BOOL_EXPR;
     expr->bool_value = value;
     return expr;
 }
 
-expr_t *create_case_expr(expr_t *expr, case_list_t *cases) {
-    expr_t *case_expr = malloc(sizeof(expr_t));
-    if (!case_expr) return NULL;
+expr_t *create_case_expr(arena_t *a, expr_t *expr, case_list_t *cases) {
+    expr_t *case_expr = arena_alloc(a, sizeof(expr_t));
     case_expr->type = CASE_EXPR;
     case_expr->case_expr.expr = expr;
     case_expr->case_expr.cases = cases;
     return case_expr;
 }
 
-expr_t *create_if_expr(expr_t *condition, expr_t *then_branch, expr_t *else_branch) {
-    expr_t *if_expr = malloc(sizeof(expr_t));
-    if (!if_expr) return NULL;
+expr_t *create_if_expr(arena_t *a, expr_t *condition, expr_t *then_branch, expr_t *else_branch) {
+    expr_t *if_expr = arena_alloc(a, sizeof(expr_t));
     if_expr->type = IF_EXPR;
     if_expr->if_expr.condition = condition;
     if_expr->if_expr.then_branch = then_branch;
@@ -211,68 +208,61 @@ expr_t *create_if_expr(expr_t *condition, expr_t *then_branch, expr_t *else_bran
     return if_expr;
 }
 
-expr_t *create_int_expr(int value) {
-    expr_t *expr = malloc(sizeof(expr_t));
-    if (!expr) return NULL;
+expr_t *create_int_expr(arena_t *a, int value) {
+    expr_t *expr = arena_alloc(a, sizeof(expr_t));
     expr->type = INT_EXPR;
     expr->int_value = value;
     return expr;
 }
 
-expr_t *create_isvoid_expr(expr_t *expr) {
-    expr_t *isvoid_expr = malloc(sizeof(expr_t));
-    if (!isvoid_expr) return NULL;
+expr_t *create_isvoid_expr(arena_t *a, expr_t *expr) {
+    expr_t *isvoid_expr = arena_alloc(a, sizeof(expr_t));
     isvoid_expr->type = ISVOID_EXPR;
     isvoid_expr->isvoid_expr.expr = expr;
     return isvoid_expr;
 }
 
-expr_t *create_let_expr(char *id, char *type, expr_t *init, expr_t *body) {
-    expr_t *let_expr = malloc(sizeof(expr_t));
-    if (!let_expr) return NULL;
+expr_t *create_let_expr(arena_t *a, const char *id, const char *type, expr_t *init, expr_t *body) {
+    expr_t *let_expr = arena_alloc(a, sizeof(expr_t));
     let_expr->type = LET_EXPR;
-    let_expr->let_expr.id = strdup_safe(id);
-    let_expr->let_expr.type = strdup_safe(type);
+    let_expr->let_expr.id = id;
+    let_expr->let_expr.type = type;
     let_expr->let_expr.init = init;
     let_expr->let_expr.body = body;
     return let_expr;
 }
 
-expr_t *create_new_expr(char *type) {
-    expr_t *new_expr = malloc(sizeof(expr_t));
-    if (!new_expr) return NULL;
+expr_t *create_new_expr(arena_t *a, const char *type) {
+    expr_t *new_expr = arena_alloc(a, sizeof(expr_t));
     new_expr->type = NEW_EXPR;
-    new_expr->string_value = strdup_safe(type);
+    new_expr->string_value = type;
     return new_expr;
 }
 
-expr_t *create_not_expr(expr_t *expr) {
-    expr_t *not_expr = malloc(sizeof(expr_t));
-    if (!not_expr) return NULL;
+expr_t *create_not_expr(arena_t *a, expr_t *expr) {
+    expr_t *not_expr = arena_alloc(a, sizeof(expr_t));
     not_expr->type = NOT_EXPR;
     not_expr->not_expr.expr = expr;
     return not_expr;
 }
 
-expr_t *create_object_expr(char *id) {
-    expr_t *object_expr = malloc(sizeof(expr_t));
-    if (!object_expr) return NULL;
+expr_t *create_object_expr(arena_t *a, const char *id) {
+    expr_t *object_expr = arena_alloc(a, sizeof(expr_t));
     object_expr->type = OBJECT_EXPR;
-    object_expr->id = strdup_safe(id);
+    object_expr->id = id;
     return object_expr;
 }
 
-expr_t *create_string_expr(char *value) {
-    expr_t *string_expr = malloc(sizeof(expr_t));
-    if (!string_expr) return NULL;
+expr_t *create_string_expr(arena_t *a, const char *value, size_t len) {
+    expr_t *string_expr = arena_alloc(a, sizeof(expr_t));
     string_expr->type = STRING_EXPR;
-    string_expr->string_value = strdup_safe(value);
+    string_expr->string_value = value;
+    string_expr->string_len = len;
     return string_expr;
 }
 
-expr_t *create_while_expr(expr_t *condition, expr_t *body) {
-    expr_t *while_expr = malloc(sizeof(expr_t));
-    if (!while_expr) return NULL;
+expr_t *create_while_expr(arena_t *a, expr_t *condition, expr_t *body) {
+    expr_t *while_expr = arena_alloc(a, sizeof(expr_t));
     while_expr->type = WHILE_EXPR;
     while_expr->while_expr.condition = condition;
     while_expr->while_expr.body = body;
@@ -9,6 +9,8 @@
 #define NODE_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include "arena.h"
 
 /* 표현식 타입 정의 */
 typedef enum {
@@ -34,15 +36,16 @@ typedef struct expr {
         struct { struct expr *condition, *then_branch, *else_branch; } if_expr;
         struct { struct expr *condition, *body; } while_expr;
         struct { struct expr_list *block_expr; } block_expr;
-        struct { char *id; struct expr *expr; } assign_expr;
-        struct { char *id; char *type; struct expr *init, *body; } let_expr;
+        struct { const char *id; struct expr *expr; } assign_expr;
+        struct { const char *id; const char *type; struct expr *init, *body; } let_expr;
         struct { struct expr *expr; struct case_list *cases; } case_expr;
         struct { struct expr *expr; } isvoid_expr;
         struct { struct expr *expr; } not_expr;
     };
-    char *id;
+    const char *id;
     int int_value;
-    char *string_value;
+    const char *string_value;
+    size_t string_len;      /* STRING_EXPR의 길이. string_value는 '\0'으로 끝나지 않는다 */
     bool bool_value;
 } expr_t;
 
@@ -54,8 +57,8 @@ typedef struct expr_list {
 
 /* formal (매개변수) 구조체 */
 typedef struct formal {
-    char *name;
-    char *type;
+    const char *name;
+    const char *type;
 } formal_t;
 
 /* formal 리스트 구조체 */
@@ -66,8 +69,8 @@ typedef struct formal_list {
 
 /* feature 구조체 (메서드 또는 속성) */
 typedef struct feature {
-    char *name;
-    char *type;
+    const char *name;
+    const char *type;
     formal_list_t *formals;
     expr_t *body;
 } feature_t;
@@ -80,8 +83,8 @@ typedef struct feature_list {
 
 /* 클래스 구조체 */
 typedef struct class {
-    char *type;
-    char *inherited;
+    const char *type;
+    const char *inherited;
     feature_list_t *features;
 } class_t;
 
@@ -93,8 +96,8 @@ typedef struct class_list {
 
 /* case 구조체 */
 typedef struct case_t {
-    char *id;
-    char *type;
+    const char *id;
+    const char *type;
     expr_t *expr;
 } case_t;
 
@@ -104,40 +107,58 @@ typedef struct case_list {
     struct case_list *next;
 } case_list_t;
 
-/* 함수 프로토타입 선언 */
-class_list_t *create_class_list(class_t *class);
-class_list_t *append_class_list(class_list_t *list, class_t *class);
-class_t *create_class(char *type, char *inherited, feature_list_t *features);
-
-feature_list_t *create_feature_list(feature_t *feature);
-feature_list_t *append_feature_list(feature_list_t *list, feature_t *feature);
-feature_t *create_method(char *name, formal_list_t *formals, char *type, expr_t *body);
-feature_t *create_attribute(char *name, char *type, expr_t *init);
-
-formal_list_t *create_formal_list(formal_t *formal);
-formal_list_t *append_formal_list(formal_list_t *list, formal_t *formal);
-formal_t *create_formal(char *name, char *type);
-
-expr_t *create_assign_expr(char *id, expr_t *expr);
-expr_t *create_if_expr(expr_t *condition, expr_t *then_branch, expr_t *else_branch);
-expr_t *create_while_expr(expr_t *condition, expr_t *body);
-expr_t *create_block_expr(expr_list_t *block);
-expr_t *create_let_expr(char *id, char *type, expr_t *init, expr_t *body);
-expr_t *create_case_expr(expr_t *expr, case_list_t *cases);
-expr_t *create_new_expr(char *type);
-expr_t *create_isvoid_expr(expr_t *expr);
-expr_t *create_not_expr(expr_t *expr);
-expr_t *create_object_expr(char *id);
-expr_t *create_int_expr(int value);
-expr_t *create_string_expr(char *value);
-expr_t *create_bool_expr(bool value);
-
-case_list_t *create_case_list(case_t *new_case);
-case_list_t *append_case_list(case_list_t *list, case_t *new_case);
-case_t *create_case(char *id, char *type, expr_t *expr);
-
-expr_list_t *create_expr_list(expr_t *expr);
-expr_list_t *append_expr_list(expr_list_t *list, expr_t *expr);
+/*
+ * 함수 프로토타입 선언.
+ * 노드와 리스트 셀은 모두 인자로 받은 아레나 a에서 잡는다. 하나씩 해제하지 않고
+ * 파싱이 끝나 트리를 다 쓴 뒤 arena_release(a)로 트리 전체를 한꺼번에 돌려준다.
+ * 이름(식별자, 타입)은 스캐너가 인턴 표(intern.h)에서 얻은 포인터를 그대로 받아 저장하므로
+ * ==로 비교할 수 있다. 생성 함수는 인턴 표를 건드리지 않으므로 스캐너가 다른 스레드에서
+ * 인턴하는 동안에도 부를 수 있다.
+ * 문자열 상수는 복사하지 않고 스캐너가 넘긴 (포인터, 길이)를 그대로 저장하므로
+ * 스캐너를 닫기 전까지만 유효하다.
+ *
+ * 리스트는 원소마다 O(1)에 덧붙이도록 만드는 동안 원형으로 둔다. create_*_list와
+ * append_*_list가 돌려주는 값은 마지막 셀이고 그 next가 첫 셀이다. 다 만든 리스트는
+ * finish_*_list로 닫아 첫 셀부터 시작해 NULL로 끝나는 리스트로 바꾼 뒤 트리에 넣는다.
+ */
+class_list_t *create_class_list(arena_t *a, class_t *class);
+class_list_t *append_class_list(arena_t *a, class_list_t *list, class_t *class);
+class_list_t *finish_class_list(class_list_t *list);
+class_t *create_class(arena_t *a, const char *type, const char *inherited, feature_list_t *features);
+
+feature_list_t *create_feature_list(arena_t *a, feature_t *feature);
+feature_list_t *append_feature_list(arena_t *a, feature_list_t *list, feature_t *feature);
+feature_list_t *finish_feature_list(feature_list_t *list);
+feature_t *create_method(arena_t *a, const char *name, formal_list_t *formals, const char *type, expr_t *body);
+feature_t *create_attribute(arena_t *a, const char *name, const char *type, expr_t *init);
+
+formal_list_t *create_formal_list(arena_t *a, formal_t *formal);
+formal_list_t *append_formal_list(arena_t *a, formal_list_t *list, formal_t *formal);
+formal_list_t *finish_formal_list(formal_list_t *list);
+formal_t *create_formal(arena_t *a, const char *name, const char *type);
+
+expr_t *create_assign_expr(arena_t *a, const char *id, expr_t *expr);
+expr_t *create_if_expr(arena_t *a, expr_t *condition, expr_t *then_branch, expr_t *else_branch);
+expr_t *create_while_expr(arena_t *a, expr_t *condition, expr_t *body);
+expr_t *create_block_expr(arena_t *a, expr_list_t *block);
+expr_t *create_let_expr(arena_t *a, const char *id, const char *type, expr_t *init, expr_t *body);
+expr_t *create_case_expr(arena_t *a, expr_t *expr, case_list_t *cases);
+expr_t *create_new_expr(arena_t *a, const char *type);
+expr_t *create_isvoid_expr(arena_t *a, expr_t *expr);
+expr_t *create_not_expr(arena_t *a, expr_t *expr);
+expr_t *create_object_expr(arena_t *a, const char *id);
+expr_t *create_int_expr(arena_t *a, int value);
+expr_t *create_string_expr(arena_t *a, const char *value, size_t len);
+expr_t *create_bool_expr(arena_t *a, bool value);
+
+case_list_t *create_case_list(arena_t *a, case_t *new_case);
+case_list_t *append_case_list(arena_t *a, case_list_t *list, case_t *new_case);
+case_list_t *finish_case_list(case_list_t *list);
+case_t *create_case(arena_t *a, const char *id, const char *type, expr_t *expr);
+
+expr_list_t *create_expr_list(arena_t *a, expr_t *expr);
+expr_list_t *append_expr_list(arena_t *a, expr_list_t *list, expr_t *expr);
+expr_list_t *finish_expr_list(expr_list_t *list);
 
 void show_class_list(class_list_t *class_list);
 
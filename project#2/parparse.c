@@ -0,0 +1,263 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+#include "parparse.h"
+#include "cool.tab.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+/*
+ * 모아 두는 토큰. 입력 전체의 토큰을 담으므로 cool_token_t의 절반 크기로 줄여 둔다.
+ * 렉심은 버퍼의 offset에 있으므로 text를 두지 않는다. 줄번호가 int이듯 렉심 하나가
+ * 4GB를 넘는 입력은 생각하지 않는다.
+ */
+typedef struct ptok {
+    size_t offset;
+    const char *ptr;            /* ID와 TYPE의 이름이나 STRING의 내용 */
+    uint32_t len;
+    int kind;
+    union {
+        uint32_t str_len;       /* STRING */
+        int value;              /* INTEGER */
+    } u;
+} ptok_t;
+
+/* 구간 하나. 토큰 [start, end)를 파싱한 문맥을 담는다 */
+typedef struct part {
+    size_t start;
+    size_t end;
+    cool_parse_t ctx;
+} part_t;
+
+/* 작업 스레드가 함께 보는 상태 */
+typedef struct parparse {
+    cool_lexer_t *lexer;        /* 토큰을 만든 스캐너. 읽기만 한다 */
+    const ptok_t *toks;
+    part_t *parts;
+    size_t nparts;
+    size_t next;                /* 다음에 가져갈 구간 */
+    int failed;                 /* 어느 구간에서든 오류가 났는가 */
+    int hugepages;
+} parparse_t;
+
+/* 배열 *p가 n+1개를 담을 수 있도록 늘린다. 메모리가 없으면 더 진행할 수 없으므로 끝낸다 */
+static void reserve(void **p, size_t *cap, size_t n, size_t size)
+{
+    if (n < *cap)
+        return;
+    *cap = *cap ? *cap * 2 : 1024;
+    if (!(*p = realloc(*p, *cap * size))) {
+        perror("cool_parser");
+        exit(1);
+    }
+}
+
+/* 모아 둔 토큰 t를 파서에 넘길 토큰으로 되살린다 */
+static void expand(const cool_lexer_t *lx, const ptok_t *t, cool_token_t *tok)
+{
+    tok->kind = t->kind;
+    tok->offset = t->offset;
+    tok->text = t->kind ? lx->buf + t->offset : "";
+    tok->len = t->len;
+    tok->name = t->kind == TYPE || t->kind == ID ? t->ptr : NULL;
+    tok->str = t->kind == STRING ? t->ptr : NULL;
+    tok->str_len = t->kind == STRING ? t->u.str_len : 0;
+    tok->value = t->kind == INTEGER ? t->u.value : 0;
+}
+
+/*
+ * 입력 끝까지 스캔하여 토큰을 모두 *toks에 모으고 그 개수를 돌려준다. 마지막 토큰은
+ * 입력 끝이다. 중괄호 깊이가 0인 CLASS 토큰의 번호를 *starts에 모은다.
+ * 짝이 맞지 않는 '}'는 깊이를 0 아래로 내리지 않는다. 그런 입력은 어차피 오류이다.
+ */
+static size_t collect(cool_lexer_t *lx, ptok_t **toks, size_t **starts, size_t *nstarts)
+{
+    size_t n = 0, cap = 0, scap = 0, depth = 0;
+    cool_token_t tok;
+    ptok_t *t;
+
+    *toks = NULL;
+    *starts = NULL;
+    *nstarts = 0;
+    do {
+        reserve((void **)toks, &cap, n, sizeof(ptok_t));
+        t = &(*toks)[n];
+        cool_lexer_next(lx, &tok);
+        t->offset = tok.offset;
+        t->ptr = tok.name ? tok.name : tok.str;
+        t->len = (uint32_t)tok.len;
+        t->kind = tok.kind;
+        if (tok.kind == STRING)
+            t->u.str_len = (uint32_t)tok.str_len;
+        else
+            t->u.value = tok.value;
+        if (tok.kind == '{')
+            depth++;
+        else if (tok.kind == '}' && depth > 0)
+            depth--;
+        else if (tok.kind == CLASS && depth == 0) {
+            reserve((void **)starts, &scap, *nstarts, sizeof(size_t));
+            (*starts)[(*nstarts)++] = n;
+        }
+        n++;
+    } while (tok.kind != 0);
+    return n;
+}
+
+/*
+ * 클래스 시작 위치에서만 끊어 구간마다 토큰이 per개 이상이 되도록 나누고 구간의 수를
+ * 돌려준다. 첫 구간은 첫 클래스 앞의 토큰도, 마지막 구간은 입력 끝도 포함한다.
+ */
+static size_t split(part_t *parts, const size_t *starts, size_t nstarts, size_t ntoks, size_t per)
+{
+    size_t n = 0, i;
+
+    parts[0].start = 0;
+    for (i = 1; i < nstarts; i++)
+        if (starts[i] - parts[n].start >= per) {
+            parts[n++].end = starts[i];
+            parts[n].start = starts[i];
+        }
+    parts[n++].end = ntoks;
+    return n;
+}
+
+/*
+ * 구간 하나를 자기 문맥과 아레나로 추측 파싱한다. 오류는 출력하지 않고 세기만 하며,
+ * 오류가 나면 더 넘기지 않고 끝낸다. 구간의 끝에서는 입력 끝을 넘겨 클래스 리스트를 닫는다.
+ */
+static void parse_part(parparse_t *pp, part_t *part)
+{
+    cool_parse_t *ctx = &part->ctx;
+    cool_token_t tok;
+    size_t i;
+
+    cool_parse_init(ctx, pp->hugepages);
+    ctx->lexer = pp->lexer;
+    ctx->speculative = 1;
+    if (cool_push_begin(ctx) < 0) {
+        perror("cool_parser");
+        exit(1);
+    }
+    for (i = part->start; i < part->end && !ctx->num_errors; i++) {
+        expand(pp->lexer, &pp->toks[i], &tok);
+        if (cool_push_token(ctx, &tok))
+            break;
+    }
+    cool_push_end(ctx);
+    ctx->lexer = NULL;          /* 스캐너는 호출자의 것이다 */
+    if (ctx->num_errors || ctx->status != 0)
+        __atomic_store_n(&pp->failed, 1, __ATOMIC_RELAXED);
+}
+
+/* 작업 스레드. 구간을 하나씩 가져가 파싱한다. 오류가 난 뒤에는 더 가져가지 않는다 */
+static void *worker(void *arg)
+{
+    parparse_t *pp = arg;
+    size_t i;
+
+    while ((i = __atomic_fetch_add(&pp->next, 1, __ATOMIC_RELAXED)) < pp->nparts &&
+           !__atomic_load_n(&pp->failed, __ATOMIC_RELAXED))
+        parse_part(pp, &pp->parts[i]);
+    return NULL;
+}
+
+/* 모은 토큰 n개를 ctx 하나로 차례로 파싱한다. 오류는 순차 파싱과 같이 출력된다 */
+static void parse_tokens(cool_parse_t *ctx, const ptok_t *toks, size_t n)
+{
+    cool_token_t tok;
+    size_t i;
+
+    if (cool_push_begin(ctx) < 0) {
+        perror("cool_parser");
+        exit(1);
+    }
+    for (i = 0; i < n; i++) {
+        expand(ctx->lexer, &toks[i], &tok);
+        if (cool_push_token(ctx, &tok))
+            break;
+    }
+    cool_push_end(ctx);
+}
+
+/*
+ * ctx->lexer에 열어 둔 스캐너의 입력을 nthreads개의 스레드로 파싱하여 트리를 ctx->program에
+ * 남기고 오류의 개수를 돌려준다. 구간의 노드는 ctx->ast로 옮기므로 cool_parse_release()가
+ * 한꺼번에 돌려준다. 모은 토큰의 렉심이 스캐너 버퍼를 가리키므로 버퍼 입력만 나누고,
+ * 스트림 입력이나 스레드가 하나일 때는 cool_parse()와 같이 파싱한다.
+ * 스캐너의 오류 메시지는 미리 스캔하면서 입력 순서대로 출력된다.
+ */
+int cool_parse_parallel(cool_parse_t *ctx, int nthreads)
+{
+    parparse_t pp;
+    pthread_t *threads;
+    ptok_t *toks;
+    size_t *starts, nstarts, ntoks, per, i;
+    class_list_t **tail;
+    int n;
+
+    if (!ctx->lexer->buf || nthreads <= 1)
+        return cool_parse(ctx);
+    ntoks = collect(ctx->lexer, &toks, &starts, &nstarts);
+    per = ntoks / ((size_t)nthreads * 4);
+    if (per < PARPARSE_MIN_TOKENS)
+        per = PARPARSE_MIN_TOKENS;
+
+    memset(&pp, 0, sizeof(pp));
+    pp.lexer = ctx->lexer;
+    pp.toks = toks;
+    pp.hugepages = ctx->ast.huge;
+    if (!(pp.parts = calloc(nstarts ? nstarts : 1, sizeof(part_t)))) {
+        perror("cool_parser");
+        exit(1);
+    }
+    pp.nparts = split(pp.parts, starts, nstarts, ntoks, per);
+    free(starts);
+    if (pp.nparts == 1) {
+        free(pp.parts);
+        parse_tokens(ctx, toks, ntoks);
+        free(toks);
+        return ctx->num_errors;
+    }
+
+    n = (size_t)nthreads < pp.nparts ? nthreads : (int)pp.nparts;
+    if (!(threads = malloc(sizeof(pthread_t) * n))) {
+        perror("cool_parser");
+        exit(1);
+    }
+    for (i = 0; i < (size_t)n; i++)
+        if (pthread_create(&threads[i], NULL, worker, &pp) != 0) {
+            perror("cool_parser");
+            exit(1);
+        }
+    for (i = 0; i < (size_t)n; i++)
+        pthread_join(threads[i], NULL);
+    free(threads);
+
+    /*
+     * 모든 구간이 오류 없이 끝났으면 구간의 클래스 리스트를 소스 순서대로 잇는다.
+     * 하나라도 오류가 났으면 추측 결과를 버리고 처음부터 순차 파싱하여 오류를 출력한다.
+     */
+    if (!pp.failed) {
+        tail = &ctx->program;
+        for (i = 0; i < pp.nparts; i++) {
+            *tail = pp.parts[i].ctx.program;
+            while (*tail)
+                tail = &(*tail)->next;
+            arena_merge(&ctx->ast, &pp.parts[i].ctx.ast);
+        }
+    } else {
+        for (i = 0; i < pp.nparts; i++)
+            cool_parse_release(&pp.parts[i].ctx);
+        parse_tokens(ctx, toks, ntoks);
+    }
+    free(pp.parts);
+    free(toks);
+    return ctx->num_errors;
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+
+/*
+ * 큰 파일 하나를 최상위 클래스 단위로 나누어 병렬로 파싱한다.
+ *
+ * 먼저 한 번 스캔하여 토큰을 모두 모으면서 중괄호 깊이가 0인 CLASS 토큰, 곧 최상위
+ * 클래스가 시작하는 곳을 찾는다. 이어진 클래스 몇 개씩을 한 구간으로 묶어 작업 스레드가
+ * 구간마다 자기 문맥과 아레나로 추측 파싱하고, 구간의 트리를 소스 순서대로 이어 붙인다.
+ * 올바른 프로그램이면 구간 하나하나가 올바른 클래스 리스트이므로 결과는 순차 파싱과 같다.
+ * 어느 구간에서든 오류가 나면 그 결과를 버리고 모은 토큰을 처음부터 순차 파싱하므로
+ * 오류 메시지의 줄번호와 순서도 순차 파싱과 같다.
+ */
+#ifndef PARPARSE_H
+#define PARPARSE_H
+
+#include "cool_parser.h"
+
+/* 한 구간의 최소 토큰 수. 이보다 작은 입력은 나누지 않는다 */
+#define PARPARSE_MIN_TOKENS 4096
+
+/* 함수 프로토타입 선언 */
+int cool_parse_parallel(cool_parse_t *ctx, int nthreads);
+
+#endif // PARPARSE_H
@@ -0,0 +1,48 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ * 2022066017 응용물리학과 이규현
+ */
+#include "tokq.h"
+#include <string.h>
+#include <sched.h>
+
+#define TOKQ_MASK (TOKQ_SIZE - 1)
+
+void tokq_init(tokq_t *q)
+{
+    memset(q, 0, sizeof(*q));
+}
+
+/*
+ * 토큰 하나를 넣는다. 큐가 가득 차면 소비자가 자리를 비울 때까지 기다린다.
+ * 입력의 끝(kind 0)은 곧바로 공개한다.
+ */
+void tokq_push(tokq_t *q, const cool_token_t *tok)
+{
+    if (q->p_head - q->p_tail == TOKQ_SIZE) {
+        __atomic_store_n(&q->head, q->p_head, __ATOMIC_RELEASE);
+        while ((q->p_tail = __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE)) + TOKQ_SIZE == q->p_head)
+            sched_yield();
+    }
+    q->slots[q->p_head++ & TOKQ_MASK] = *tok;
+    if ((q->p_head & (TOKQ_BATCH - 1)) == 0 || tok->kind == 0)
+        __atomic_store_n(&q->head, q->p_head, __ATOMIC_RELEASE);
+}
+
+/*
+ * 토큰 하나를 꺼낸다. 공개된 토큰이 없으면 생산자가 공개할 때까지 기다린다.
+ */
+void tokq_pop(tokq_t *q, cool_token_t *tok)
+{
+    if (q->c_tail == q->c_head) {
+        __atomic_store_n(&q->tail, q->c_tail, __ATOMIC_RELEASE);
+        while ((q->c_head = __atomic_load_n(&q->head, __ATOMIC_ACQUIRE)) == q->c_tail)
+            sched_yield();
+    }
+    *tok = q->slots[q->c_tail++ & TOKQ_MASK];
+    if ((q->c_tail & (TOKQ_BATCH - 1)) == 0)
+        __atomic_store_n(&q->tail, q->c_tail, __ATOMIC_RELEASE);
+}
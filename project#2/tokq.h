@@ -0,0 +1,40 @@
+/*
+ * Copyright(c) 2020-2024 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 자는 이 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ * 2022066017 응용물리학과 이규현
+ */
+
+/*
+ * 스캐너 스레드와 파서 스레드 사이의 토큰 큐.
+ * 생산자 하나와 소비자 하나만 쓰는 고정 크기 링 버퍼이며 잠금을 쓰지 않는다.
+ * 양쪽 모두 상대의 위치를 캐시해 두고, 자기 위치는 TOKQ_BATCH개마다 한 번씩만
+ * 공개하므로 토큰마다 캐시 라인을 주고받지 않는다.
+ * 큐가 가득 차거나 비면 sched_yield()로 상대에게 양보하며 기다린다.
+ */
+#ifndef TOKQ_H
+#define TOKQ_H
+
+#include <stddef.h>
+#include "cool_lexer.h"
+
+#define TOKQ_SIZE  4096         /* 2의 거듭제곱 */
+#define TOKQ_BATCH 64
+
+typedef struct tokq {
+    cool_token_t slots[TOKQ_SIZE];
+    _Alignas(64) size_t head;   /* 생산자가 공개한 위치 */
+    _Alignas(64) size_t tail;   /* 소비자가 공개한 위치 */
+    _Alignas(64) size_t p_head; /* 생산자 전용 */
+    size_t p_tail;
+    _Alignas(64) size_t c_tail; /* 소비자 전용 */
+    size_t c_head;
+} tokq_t;
+
+/* 함수 프로토타입 선언 */
+void tokq_init(tokq_t *q);
+void tokq_push(tokq_t *q, const cool_token_t *tok);
+void tokq_pop(tokq_t *q, cool_token_t *tok);
+
+#endif // TOKQ_H
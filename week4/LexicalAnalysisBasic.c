@@ -1,8 +1,283 @@
 //
 // Created by 이규현 on 2024. 9. 26..
 //
+// 손으로 작성한 COOL 스캐너.
+// flex의 상태 전이 표 없이 첫 바이트에 대한 switch로 토큰을 곧바로 인식하며,
+// compiler_project1/cool.l과 같은 토큰 값(cool.tab.h)과 같은 덤프 형식을 출력한다.
+//
+//   빌드: compiler_project1에서 make cool_scan
+//   사용법: ./cool_scan [file.cl]
+//
 #include <stdio.h>
-int main() {
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "cool.tab.h"
+#include "outbuf.h"
+
+static outbuf_t out;
+static size_t lineNo = 1;
+
+// 오류를 알리기 전에 지금까지 인식한 토큰을 먼저 내보낸다
+static void fail(void) {
+  if (outbuf_flush(&out) < 0)
+    perror("cool_scan");
+  exit(1);
+}
+
+// 입력 전체를 읽는다. 끝에 '\0'을 붙여 두면 한 바이트 앞을 볼 때 범위를 검사하지 않아도 된다
+static char *read_all(FILE *fp, size_t *size) {
+  size_t cap = 64 * 1024, len = 0, n;
+  char *buf = malloc(cap + 1), *tmp;
+
+  while (buf && (n = fread(buf + len, 1, cap - len, fp)) > 0) {
+    len += n;
+    if (len == cap) {
+      cap *= 2;
+      if (!(tmp = realloc(buf, cap + 1)))
+        free(buf);
+      buf = tmp;
+    }
+  }
+  if (!buf) {
+    perror("cool_scan");
+    exit(1);
+  }
+  buf[len] = '\0';
+  *size = len;
+  return buf;
+}
+
+static int is_ident(unsigned char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// 예약어이면 토큰 값을, 아니면 0을 돌려준다. 소문자 철자 외에 cool.l이 받아들이는 철자도 허용한다
+static int keyword(const char *s, size_t n) {
+  switch (n) {
+  case 2:
+    if (!memcmp(s, "if", 2) || !memcmp(s, "If", 2)) return IF;
+    if (!memcmp(s, "fi", 2)) return FI;
+    if (!memcmp(s, "in", 2)) return IN;
+    if (!memcmp(s, "of", 2)) return OF;
+    break;
+  case 3:
+    if (!memcmp(s, "let", 3)) return LET;
+    if (!memcmp(s, "new", 3)) return NEW;
+    if (!memcmp(s, "not", 3)) return NOT;
+    break;
+  case 4:
+    if (!memcmp(s, "then", 4)) return THEN;
+    if (!memcmp(s, "else", 4) || !memcmp(s, "ELSE", 4)) return ELSE;
+    if (!memcmp(s, "loop", 4)) return LOOP;
+    if (!memcmp(s, "pool", 4)) return POOL;
+    if (!memcmp(s, "case", 4)) return CASE;
+    if (!memcmp(s, "esac", 4)) return ESAC;
+    if (!memcmp(s, "true", 4)) return TRUE;
+    break;
+  case 5:
+    if (!memcmp(s, "class", 5) || !memcmp(s, "Class", 5)) return CLASS;
+    if (!memcmp(s, "while", 5)) return WHILE;
+    if (!memcmp(s, "false", 5)) return FALSE;
+    break;
+  case 6:
+    if (!memcmp(s, "isvoid", 6)) return ISVOID;
+    break;
+  case 8:
+    if (!memcmp(s, "inherits", 8) || !memcmp(s, "inheritS", 8)) return INHERITS;
+    break;
+  }
   return 0;
 }
 
+// 문자열 상수의 끝(닫는 큰따옴표 다음)을 찾는다. 줄바꿈이나 잘못된 이스케이프를 만나면 NULL이다
+static const char *string_end(const char *p, const char *end) {
+  for (p++; p < end; p++) {
+    switch (*p) {
+    case '"':
+      return p + 1;
+    case '\\':
+      if (p + 1 == end || !strchr("btnf\"\\", p[1]))
+        return NULL;
+      p++;
+      break;
+    case '\n':
+      return NULL;
+    }
+  }
+  return NULL;
+}
+
+// 여러 줄 주석을 건너뛴다. p는 여는 "(*" 다음을 가리키며, 닫는 "*)" 다음 위치를 돌려준다
+static const char *skip_comment(const char *p, const char *end) {
+  int depth = 1;
+
+  while (p < end) {
+    switch (*p) {
+    case '(':
+      if (p[1] == '*') {
+        depth++;
+        p += 2;
+        continue;
+      }
+      break;
+    case '*':
+      if (p[1] == ')') {
+        p += 2;
+        if (--depth == 0)
+          return p;
+        continue;
+      }
+      break;
+    case '\n':
+      lineNo++;
+      break;
+    }
+    p++;
+  }
+  fprintf(stderr, "Error: EOF in comment at line %zu\n", lineNo);
+  fail();
+  return end;
+}
+
+// 입력 끝까지 토큰을 인식하여 줄번호, 타입, 문자열(lexeme)을 출력한다
+static void scan(const char *p, const char *end) {
+  size_t nameLen[sizeof(tokenName) / sizeof(tokenName[0])];
+  const char *start, *q;
+  size_t i;
+  int kind;
+
+  for (i = 0; i < sizeof(nameLen) / sizeof(nameLen[0]); i++)
+    nameLen[i] = strlen(tokenName[i]);
+  while (p < end) {
+    start = p;
+    switch (*p) {
+    case ' ': case '\t':
+      p++;
+      continue;
+    case '\n':
+      lineNo++;
+      p++;
+      continue;
+    case '\r':
+      if (p[1] != '\n')
+        goto invalid;
+      lineNo++;
+      p += 2;
+      continue;
+    case 'A' ... 'Z':
+      for (p++; is_ident(*p); p++)
+        ;
+      kind = keyword(start, p - start);
+      if (!kind)
+        kind = TYPE;
+      break;
+    case 'a' ... 'z': case '_':
+      for (p++; is_ident(*p); p++)
+        ;
+      kind = keyword(start, p - start);
+      if (!kind)
+        kind = ID;
+      break;
+    case '0' ... '9':
+      for (p++; *p >= '0' && *p <= '9'; p++)
+        ;
+      kind = INTEGER;
+      break;
+    case '"':
+      if (!(q = string_end(p, end)))
+        goto invalid;
+      p = q;
+      kind = STRING;
+      break;
+    case '(':
+      if (p[1] == '*') {
+        p = skip_comment(p + 2, end);
+        continue;
+      }
+      p++;
+      kind = LPAREN;
+      break;
+    case '*':
+      if (p[1] == ')') {
+        fprintf(stderr, "Error: Unmatched *) at line %zu\n", lineNo);
+        fail();
+      }
+      p++;
+      kind = MUL;
+      break;
+    case '-':
+      if (p[1] == '-') {
+        q = memchr(p, '\n', end - p);
+        if (!q)
+          return;
+        lineNo++;
+        p = q + 1;
+        continue;
+      }
+      p++;
+      kind = MINUS;
+      break;
+    case '<':
+      if (p[1] == '=') {
+        p += 2;
+        kind = LTE;
+      } else if (p[1] == '-') {
+        p += 2;
+        kind = ASSIGN;
+      } else {
+        p++;
+        kind = LT;
+      }
+      break;
+    case '=':
+      if (p[1] == '>') {
+        p += 2;
+        kind = DARROW;
+      } else {
+        p++;
+        kind = EQUAL;
+      }
+      break;
+    case ')': p++; kind = RPAREN; break;
+    case '{': p++; kind = LBRACE; break;
+    case '}': p++; kind = RBRACE; break;
+    case ',': p++; kind = COMMA; break;
+    case ';': p++; kind = SEMICOLON; break;
+    case ':': p++; kind = COLON; break;
+    case '.': p++; kind = DOT; break;
+    case '+': p++; kind = PLUS; break;
+    case '/': p++; kind = DIV; break;
+    case '~': p++; kind = NEG; break;
+    case '@': p++; kind = ATSIGN; break;
+    default:
+    invalid:
+      fprintf(stderr, "Invalid character %.1s in line %zu\n", p, lineNo);
+      fail();
+      return;
+    }
+    outbuf_token(&out, lineNo, tokenName[kind - 100], nameLen[kind - 100], start, p - start);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  FILE *fp = stdin;
+  char *buf;
+  size_t size;
+
+  if (argc > 1 && !(fp = fopen(argv[1], "r"))) {
+    printf("\"%s\"는 잘못된 파일 경로입니다.\n", argv[1]);
+    exit(1);
+  }
+  if (outbuf_init(&out, STDOUT_FILENO) < 0) {
+    perror("cool_scan");
+    exit(1);
+  }
+  buf = read_all(fp, &size);
+  scan(buf, buf + size);
+  if (outbuf_flush(&out) < 0) {
+    perror("cool_scan");
+    return 1;
+  }
+  return 0;
+}